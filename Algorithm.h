@@ -0,0 +1,1002 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <new>
+
+#include "TypeTraits.h"
+#include "Utility.h"
+#include "Functional.h"
+
+// The searches use the widest vector instructions the compiler was told it may use
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STDLIB_VECTOR_SEARCH
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define STDLIB_VECTOR_SEARCH
+#endif
+
+#if defined(USE_NAMESPACE_STD)
+namespace stdlib
+{
+}
+
+namespace std
+{
+	using namespace stdlib;
+}
+#endif
+
+namespace stdlib
+{
+
+	//
+	//
+	// Declarations
+	//
+	//
+
+	// Only the pointer forms are provided.
+	// Trivially copyable types are handled with memmove, memcpy and memset.
+	// fill and the searches are constexpr from C++14, but the memset and vector paths
+	// are only skipped at compile time if the compiler has __builtin_is_constant_evaluated.
+
+	template< typename Type >
+	Type * copy(const Type * first, const Type * last, Type * destination);
+
+
+	template< typename Type >
+	Type * copy_backward(const Type * first, const Type * last, Type * destinationLast);
+
+
+	template< typename Type >
+	Type * move(Type * first, Type * last, Type * destination);
+
+
+	template< typename Type >
+	Type * move_backward(Type * first, Type * last, Type * destinationLast);
+
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 void fill(Type * first, Type * last, const Type & value);
+
+
+	// From <memory>, for constructing into and destroying uninitialised storage
+
+	template< typename Type >
+	Type * uninitialized_copy(const Type * first, const Type * last, Type * destination);
+
+
+	// Since C++17
+	template< typename Type >
+	Type * uninitialized_move(Type * first, Type * last, Type * destination);
+
+
+	// Since C++17
+	template< typename Type >
+	void destroy(Type * first, Type * last);
+
+
+	// Searches
+	// 1, 2 and 4 byte integral types are compared a whole vector at a time when SSE2 or AVX2 is enabled
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find(const Type * first, const Type * last, const Type & value);
+
+
+	// Since C++23, returns last if there is no match
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find_last(const Type * first, const Type * last, const Type & value);
+
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 size_t count(const Type * first, const Type * last, const Type & value);
+
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find_first_of(const Type * first, const Type * last, const Type * setFirst, const Type * setLast);
+
+
+	// Reordering
+
+	template< typename Type >
+	void reverse(Type * first, Type * last);
+
+
+	// Returns where first ended up
+	template< typename Type >
+	Type * rotate(Type * first, Type * middle, Type * last);
+
+
+	// Not stable, returns the start of the items that don't satisfy predicate
+	template< typename Type, typename Predicate >
+	Type * partition(Type * first, Type * last, Predicate predicate);
+
+
+	// Stable, moves the items that don't satisfy predicate to the front in one pass
+	// and returns the end of them. The items after that are left moved from.
+	template< typename Type, typename Predicate >
+	Type * remove_if(Type * first, Type * last, Predicate predicate);
+
+
+	// Sorting
+	// Introsort: quicksort with a median of three pivot,
+	// switching to heapsort if it recurses too deeply and insertion sort for short runs
+
+	template< typename Type >
+	void sort(Type * first, Type * last);
+
+
+	template< typename Type, typename Compare >
+	void sort(Type * first, Type * last, Compare compare);
+
+
+	// Binary searches, the items must already be sorted
+
+	template< typename Type >
+	const Type * lower_bound(const Type * first, const Type * last, const Type & value);
+
+
+	template< typename Type, typename Compare >
+	const Type * lower_bound(const Type * first, const Type * last, const Type & value, Compare compare);
+
+
+	template< typename Type >
+	const Type * upper_bound(const Type * first, const Type * last, const Type & value);
+
+
+	template< typename Type, typename Compare >
+	const Type * upper_bound(const Type * first, const Type * last, const Type & value, Compare compare);
+
+
+	template< typename Type >
+	bool binary_search(const Type * first, const Type * last, const Type & value);
+
+
+	template< typename Type, typename Compare >
+	bool binary_search(const Type * first, const Type * last, const Type & value, Compare compare);
+
+	//
+	//
+	// Implementation Details
+	//
+	//
+
+	namespace details
+	{
+		template< typename Type >
+		Type * copy(const Type * first, const Type * last, Type * destination, true_type)
+		{
+			const auto count = (last - first);
+			memmove(destination, first, count * sizeof(Type));
+			return (destination + count);
+		}
+
+		template< typename Type >
+		Type * copy(const Type * first, const Type * last, Type * destination, false_type)
+		{
+			for (; first != last; ++first, ++destination)
+				*destination = *first;
+
+			return destination;
+		}
+
+		template< typename Type >
+		Type * copy_backward(const Type * first, const Type * last, Type * destinationLast, true_type)
+		{
+			const auto count = (last - first);
+			memmove(destinationLast - count, first, count * sizeof(Type));
+			return (destinationLast - count);
+		}
+
+		template< typename Type >
+		Type * copy_backward(const Type * first, const Type * last, Type * destinationLast, false_type)
+		{
+			while (first != last)
+				*--destinationLast = *--last;
+
+			return destinationLast;
+		}
+
+		template< typename Type >
+		Type * move(Type * first, Type * last, Type * destination, true_type)
+		{
+			const auto count = (last - first);
+			memmove(destination, first, count * sizeof(Type));
+			return (destination + count);
+		}
+
+		template< typename Type >
+		Type * move(Type * first, Type * last, Type * destination, false_type)
+		{
+			for (; first != last; ++first, ++destination)
+				*destination = stdlib::move(*first);
+
+			return destination;
+		}
+
+		template< typename Type >
+		Type * move_backward(Type * first, Type * last, Type * destinationLast, true_type)
+		{
+			const auto count = (last - first);
+			memmove(destinationLast - count, first, count * sizeof(Type));
+			return (destinationLast - count);
+		}
+
+		template< typename Type >
+		Type * move_backward(Type * first, Type * last, Type * destinationLast, false_type)
+		{
+			while (first != last)
+				*--destinationLast = stdlib::move(*--last);
+
+			return destinationLast;
+		}
+
+		// Single bytes can be set in one go
+		template< typename Type >
+		void fill(Type * first, Type * last, const Type & value, true_type, true_type)
+		{
+			unsigned char byte;
+			memcpy(&byte, &value, sizeof(byte));
+			memset(first, byte, (last - first));
+		}
+
+		// Store the first 16 bytes or so one item at a time, then keep doubling the filled block.
+		// Short runs, such as the rows of a GridRegion, then need one memcpy at most.
+		template< typename Type >
+		void fill(Type * first, Type * last, const Type & value, true_type, false_type)
+		{
+			const auto count = (last - first);
+			const decltype(last - first) seedCount = (sizeof(Type) < 16) ? (16 / sizeof(Type)) : 1;
+
+			decltype(last - first) filled = 0;
+			for (; (filled < seedCount) && (filled < count); ++filled)
+				first[filled] = value;
+
+			if (filled == count)
+				return;
+
+			for (; (filled * 2) <= count; filled *= 2)
+				memcpy(first + filled, first, filled * sizeof(Type));
+
+			memcpy(first + filled, first, (count - filled) * sizeof(Type));
+		}
+
+		template< typename Type, typename IsByte >
+		STDLIB_CONSTEXPR14 void fill(Type * first, Type * last, const Type & value, false_type, IsByte)
+		{
+			for (; first != last; ++first)
+				*first = value;
+		}
+
+		template< typename Type >
+		Type * uninitialized_copy(const Type * first, const Type * last, Type * destination, true_type)
+		{
+			const auto count = (last - first);
+			memcpy(destination, first, count * sizeof(Type));
+			return (destination + count);
+		}
+
+		template< typename Type >
+		Type * uninitialized_copy(const Type * first, const Type * last, Type * destination, false_type)
+		{
+			for (; first != last; ++first, ++destination)
+				::new (static_cast<void *>(destination)) Type(*first);
+
+			return destination;
+		}
+
+		template< typename Type >
+		Type * uninitialized_move(Type * first, Type * last, Type * destination, true_type)
+		{
+			const auto count = (last - first);
+			memcpy(destination, first, count * sizeof(Type));
+			return (destination + count);
+		}
+
+		template< typename Type >
+		Type * uninitialized_move(Type * first, Type * last, Type * destination, false_type)
+		{
+			for (; first != last; ++first, ++destination)
+				::new (static_cast<void *>(destination)) Type(stdlib::move(*first));
+
+			return destination;
+		}
+
+		template< typename Type >
+		void destroy(Type *, Type *, true_type)
+		{
+		}
+
+		template< typename Type >
+		void destroy(Type * first, Type * last, false_type)
+		{
+			for (; first != last; ++first)
+				first->~Type();
+		}
+
+		template< typename Type >
+		STDLIB_CONSTEXPR14 const Type * find(const Type * first, const Type * last, const Type & value, false_type)
+		{
+			for (; first != last; ++first)
+				if (*first == value)
+					return first;
+
+			return last;
+		}
+
+		template< typename Type >
+		STDLIB_CONSTEXPR14 const Type * find_last(const Type * first, const Type * last, const Type & value, false_type)
+		{
+			for (const Type * current = last; current != first; --current)
+				if (*(current - 1) == value)
+					return (current - 1);
+
+			return last;
+		}
+
+		template< typename Type >
+		STDLIB_CONSTEXPR14 size_t count(const Type * first, const Type * last, const Type & value, false_type)
+		{
+			size_t result = 0;
+
+			for (; first != last; ++first)
+				if (*first == value)
+					++result;
+
+			return result;
+		}
+
+		template< typename Type >
+		STDLIB_CONSTEXPR14 const Type * find_first_of(const Type * first, const Type * last, const Type * setFirst, const Type * setLast, false_type)
+		{
+			for (; first != last; ++first)
+				for (const Type * set = setFirst; set != setLast; ++set)
+					if (*first == *set)
+						return first;
+
+			return last;
+		}
+
+#if defined(STDLIB_VECTOR_SEARCH)
+		namespace vector
+		{
+#if defined(__AVX2__)
+			using Block = __m256i;
+
+			inline Block load(const void * pointer)
+			{
+				return _mm256_loadu_si256(static_cast<const Block *>(pointer));
+			}
+
+			inline void store(void * pointer, Block block)
+			{
+				_mm256_storeu_si256(static_cast<Block *>(pointer), block);
+			}
+
+			inline Block zero()
+			{
+				return _mm256_setzero_si256();
+			}
+
+			inline Block either(Block left, Block right)
+			{
+				return _mm256_or_si256(left, right);
+			}
+
+			// One bit per byte
+			inline uint32_t getMask(Block block)
+			{
+				return static_cast<uint32_t>(_mm256_movemask_epi8(block));
+			}
+
+			template< size_t size >
+			struct Lanes;
+
+			template<>
+			struct Lanes<1>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+				static Block equal(Block left, Block right) { return _mm256_cmpeq_epi8(left, right); }
+				static Block subtract(Block left, Block right) { return _mm256_sub_epi8(left, right); }
+			};
+
+			template<>
+			struct Lanes<2>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm256_set1_epi16(static_cast<short>(value)); }
+				static Block equal(Block left, Block right) { return _mm256_cmpeq_epi16(left, right); }
+				static Block subtract(Block left, Block right) { return _mm256_sub_epi16(left, right); }
+			};
+
+			template<>
+			struct Lanes<4>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+				static Block equal(Block left, Block right) { return _mm256_cmpeq_epi32(left, right); }
+				static Block subtract(Block left, Block right) { return _mm256_sub_epi32(left, right); }
+			};
+#else
+			using Block = __m128i;
+
+			inline Block load(const void * pointer)
+			{
+				return _mm_loadu_si128(static_cast<const Block *>(pointer));
+			}
+
+			inline void store(void * pointer, Block block)
+			{
+				_mm_storeu_si128(static_cast<Block *>(pointer), block);
+			}
+
+			inline Block zero()
+			{
+				return _mm_setzero_si128();
+			}
+
+			inline Block either(Block left, Block right)
+			{
+				return _mm_or_si128(left, right);
+			}
+
+			// One bit per byte
+			inline uint32_t getMask(Block block)
+			{
+				return static_cast<uint32_t>(_mm_movemask_epi8(block));
+			}
+
+			template< size_t size >
+			struct Lanes;
+
+			template<>
+			struct Lanes<1>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm_set1_epi8(static_cast<char>(value)); }
+				static Block equal(Block left, Block right) { return _mm_cmpeq_epi8(left, right); }
+				static Block subtract(Block left, Block right) { return _mm_sub_epi8(left, right); }
+			};
+
+			template<>
+			struct Lanes<2>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm_set1_epi16(static_cast<short>(value)); }
+				static Block equal(Block left, Block right) { return _mm_cmpeq_epi16(left, right); }
+				static Block subtract(Block left, Block right) { return _mm_sub_epi16(left, right); }
+			};
+
+			template<>
+			struct Lanes<4>
+			{
+				template< typename Type >
+				static Block broadcast(Type value) { return _mm_set1_epi32(static_cast<int>(value)); }
+				static Block equal(Block left, Block right) { return _mm_cmpeq_epi32(left, right); }
+				static Block subtract(Block left, Block right) { return _mm_sub_epi32(left, right); }
+			};
+#endif
+
+			constexpr static const size_t blockSize = sizeof(Block);
+		}
+
+		// Each matching item sets sizeof(Type) bits of the mask,
+		// so bit positions are divided by the item size to get an index
+
+		template< typename Type >
+		const Type * find(const Type * first, const Type * last, const Type & value, true_type)
+		{
+			using Lanes = vector::Lanes<sizeof(Type)>;
+			constexpr ptrdiff_t perBlock = (vector::blockSize / sizeof(Type));
+
+			const vector::Block needle = Lanes::broadcast(value);
+
+			for (; (last - first) >= perBlock; first += perBlock)
+			{
+				const uint32_t mask = vector::getMask(Lanes::equal(vector::load(first), needle));
+
+				if (mask != 0)
+					return (first + (__builtin_ctz(mask) / sizeof(Type)));
+			}
+
+			return find(first, last, value, false_type());
+		}
+
+		template< typename Type >
+		const Type * find_last(const Type * first, const Type * last, const Type & value, true_type)
+		{
+			using Lanes = vector::Lanes<sizeof(Type)>;
+			constexpr ptrdiff_t perBlock = (vector::blockSize / sizeof(Type));
+
+			const vector::Block needle = Lanes::broadcast(value);
+
+			for (const Type * end = last; (end - first) >= perBlock; end -= perBlock)
+			{
+				const uint32_t mask = vector::getMask(Lanes::equal(vector::load(end - perBlock), needle));
+
+				if (mask != 0)
+					return ((end - perBlock) + ((31 - __builtin_clz(mask)) / sizeof(Type)));
+			}
+
+			// Whatever didn't fill a block is at the front
+			const Type * const end = (first + ((last - first) % perBlock));
+			const Type * const result = find_last(first, end, value, false_type());
+			return (result != end) ? result : last;
+		}
+
+		// A comparison is all ones in every matching lane, so subtracting it adds one to that lane's count.
+		// The lane counts are added up before the narrowest of them could overflow.
+		template< typename Type >
+		size_t count(const Type * first, const Type * last, const Type & value, true_type)
+		{
+			using Lanes = vector::Lanes<sizeof(Type)>;
+			using LaneType = conditional_t<(sizeof(Type) == 1), uint8_t, conditional_t<(sizeof(Type) == 2), uint16_t, uint32_t>>;
+
+			constexpr ptrdiff_t perBlock = (vector::blockSize / sizeof(Type));
+			constexpr ptrdiff_t maxBlocks = (sizeof(Type) == 1) ? 255 : 65535;
+
+			const vector::Block needle = Lanes::broadcast(value);
+
+			size_t result = 0;
+
+			while ((last - first) >= perBlock)
+			{
+				const ptrdiff_t blockCount = ((last - first) / perBlock);
+				const Type * const end = (first + (((blockCount < maxBlocks) ? blockCount : maxBlocks) * perBlock));
+
+				vector::Block counts = vector::zero();
+
+				for (; first != end; first += perBlock)
+					counts = Lanes::subtract(counts, Lanes::equal(vector::load(first), needle));
+
+				LaneType lanes[perBlock];
+				vector::store(lanes, counts);
+
+				for (ptrdiff_t index = 0; index < perBlock; ++index)
+					result += lanes[index];
+			}
+
+			return (result + count(first, last, value, false_type()));
+		}
+
+		template< typename Type >
+		const Type * find_first_of(const Type * first, const Type * last, const Type * setFirst, const Type * setLast, true_type)
+		{
+			using Lanes = vector::Lanes<sizeof(Type)>;
+			constexpr ptrdiff_t perBlock = (vector::blockSize / sizeof(Type));
+
+			if (setFirst == setLast)
+				return last;
+
+			for (; (last - first) >= perBlock; first += perBlock)
+			{
+				const vector::Block block = vector::load(first);
+				vector::Block matches = Lanes::equal(block, Lanes::broadcast(*setFirst));
+
+				for (const Type * set = (setFirst + 1); set != setLast; ++set)
+					matches = vector::either(matches, Lanes::equal(block, Lanes::broadcast(*set)));
+
+				const uint32_t mask = vector::getMask(matches);
+
+				if (mask != 0)
+					return (first + (__builtin_ctz(mask) / sizeof(Type)));
+			}
+
+			return find_first_of(first, last, setFirst, setLast, false_type());
+		}
+
+		template< typename Type >
+		using is_vector_searchable = bool_constant<is_integral<Type>::value && ((sizeof(Type) == 1) || (sizeof(Type) == 2) || (sizeof(Type) == 4))>;
+#else
+		template< typename Type >
+		using is_vector_searchable = false_type;
+#endif
+
+		// Runs shorter than this are left for insertion sort
+		constexpr static const ptrdiff_t sortThreshold = 16;
+
+		template< typename Type, typename Compare >
+		void insertion_sort(Type * first, Type * last, Compare & compare)
+		{
+			if (first == last)
+				return;
+
+			for (Type * current = (first + 1); current != last; ++current)
+			{
+				Type value = stdlib::move(*current);
+				Type * hole = current;
+
+				for (; (hole != first) && compare(value, *(hole - 1)); --hole)
+					*hole = stdlib::move(*(hole - 1));
+
+				*hole = stdlib::move(value);
+			}
+		}
+
+		template< typename Type, typename Compare >
+		void sift_down(Type * first, ptrdiff_t index, ptrdiff_t count, Compare & compare)
+		{
+			Type value = stdlib::move(first[index]);
+
+			for (ptrdiff_t child = ((index * 2) + 1); child < count; child = ((index * 2) + 1))
+			{
+				if (((child + 1) < count) && compare(first[child], first[child + 1]))
+					++child;
+
+				if (!compare(value, first[child]))
+					break;
+
+				first[index] = stdlib::move(first[child]);
+				index = child;
+			}
+
+			first[index] = stdlib::move(value);
+		}
+
+		template< typename Type, typename Compare >
+		void heap_sort(Type * first, Type * last, Compare & compare)
+		{
+			const ptrdiff_t count = (last - first);
+
+			for (ptrdiff_t index = (count / 2); index > 0; --index)
+				sift_down(first, index - 1, count, compare);
+
+			for (ptrdiff_t end = (count - 1); end > 0; --end)
+			{
+				stdlib::swap(first[0], first[end]);
+				sift_down(first, 0, end, compare);
+			}
+		}
+
+		// Swaps the median of a, b and c into result
+		template< typename Type, typename Compare >
+		void move_median_to_first(Type * result, Type * a, Type * b, Type * c, Compare & compare)
+		{
+			if (compare(*a, *b))
+			{
+				if (compare(*b, *c))
+					stdlib::swap(*result, *b);
+				else if (compare(*a, *c))
+					stdlib::swap(*result, *c);
+				else
+					stdlib::swap(*result, *a);
+			}
+			else if (compare(*a, *c))
+				stdlib::swap(*result, *a);
+			else if (compare(*b, *c))
+				stdlib::swap(*result, *c);
+			else
+				stdlib::swap(*result, *b);
+		}
+
+		// The pivot is known to lie within the range, so the scans need no bounds checks
+		template< typename Type, typename Compare >
+		Type * unguarded_partition(Type * first, Type * last, const Type & pivot, Compare & compare)
+		{
+			for (;;)
+			{
+				while (compare(*first, pivot))
+					++first;
+
+				--last;
+
+				while (compare(pivot, *last))
+					--last;
+
+				if (!(first < last))
+					return first;
+
+				stdlib::swap(*first, *last);
+				++first;
+			}
+		}
+
+		template< typename Type, typename Compare >
+		void introsort_loop(Type * first, Type * last, uint8_t depthLimit, Compare & compare)
+		{
+			while ((last - first) > sortThreshold)
+			{
+				if (depthLimit == 0)
+				{
+					heap_sort(first, last, compare);
+					return;
+				}
+
+				--depthLimit;
+
+				move_median_to_first(first, first + 1, first + ((last - first) / 2), last - 1, compare);
+				Type * const cut = unguarded_partition(first + 1, last, *first, compare);
+
+				// Recurse into the shorter side and loop on the longer one, to keep the stack shallow
+				if ((cut - first) < (last - cut))
+				{
+					introsort_loop(first, cut, depthLimit, compare);
+					first = cut;
+				}
+				else
+				{
+					introsort_loop(cut, last, depthLimit, compare);
+					last = cut;
+				}
+			}
+		}
+	}
+
+	//
+	//
+	// Definitions
+	//
+	//
+
+	template< typename Type >
+	Type * copy(const Type * first, const Type * last, Type * destination)
+	{
+		return details::copy(first, last, destination, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	Type * copy_backward(const Type * first, const Type * last, Type * destinationLast)
+	{
+		return details::copy_backward(first, last, destinationLast, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	Type * move(Type * first, Type * last, Type * destination)
+	{
+		return details::move(first, last, destination, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	Type * move_backward(Type * first, Type * last, Type * destinationLast)
+	{
+		return details::move_backward(first, last, destinationLast, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 void fill(Type * first, Type * last, const Type & value)
+	{
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+		if (is_constant_evaluated())
+		{
+			details::fill(first, last, value, false_type(), false_type());
+			return;
+		}
+#endif
+		details::fill(first, last, value, is_trivially_copyable<Type>(), bool_constant<(sizeof(Type) == 1)>());
+	}
+
+	template< typename Type >
+	Type * uninitialized_copy(const Type * first, const Type * last, Type * destination)
+	{
+		return details::uninitialized_copy(first, last, destination, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	Type * uninitialized_move(Type * first, Type * last, Type * destination)
+	{
+		return details::uninitialized_move(first, last, destination, is_trivially_copyable<Type>());
+	}
+
+	template< typename Type >
+	void destroy(Type * first, Type * last)
+	{
+		details::destroy(first, last, is_trivially_destructible<Type>());
+	}
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find(const Type * first, const Type * last, const Type & value)
+	{
+		// The vector instructions can't be used at compile time
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+		if (is_constant_evaluated())
+			return details::find(first, last, value, false_type());
+#endif
+		return details::find(first, last, value, details::is_vector_searchable<Type>());
+	}
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find_last(const Type * first, const Type * last, const Type & value)
+	{
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+		if (is_constant_evaluated())
+			return details::find_last(first, last, value, false_type());
+#endif
+		return details::find_last(first, last, value, details::is_vector_searchable<Type>());
+	}
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 size_t count(const Type * first, const Type * last, const Type & value)
+	{
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+		if (is_constant_evaluated())
+			return details::count(first, last, value, false_type());
+#endif
+		return details::count(first, last, value, details::is_vector_searchable<Type>());
+	}
+
+	template< typename Type >
+	STDLIB_CONSTEXPR14 const Type * find_first_of(const Type * first, const Type * last, const Type * setFirst, const Type * setLast)
+	{
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+		if (is_constant_evaluated())
+			return details::find_first_of(first, last, setFirst, setLast, false_type());
+#endif
+		return details::find_first_of(first, last, setFirst, setLast, details::is_vector_searchable<Type>());
+	}
+
+	template< typename Type >
+	void reverse(Type * first, Type * last)
+	{
+		for (; (first != last) && (first != --last); ++first)
+			stdlib::swap(*first, *last);
+	}
+
+	template< typename Type >
+	Type * rotate(Type * first, Type * middle, Type * last)
+	{
+		reverse(first, middle);
+		reverse(middle, last);
+		reverse(first, last);
+		return (first + (last - middle));
+	}
+
+	template< typename Type, typename Predicate >
+	Type * partition(Type * first, Type * last, Predicate predicate)
+	{
+		for (;;)
+		{
+			for (;; ++first)
+			{
+				if (first == last)
+					return first;
+
+				if (!predicate(*first))
+					break;
+			}
+
+			do
+			{
+				--last;
+
+				if (first == last)
+					return first;
+			}
+			while (!predicate(*last));
+
+			stdlib::swap(*first, *last);
+			++first;
+		}
+	}
+
+	template< typename Type, typename Predicate >
+	Type * remove_if(Type * first, Type * last, Predicate predicate)
+	{
+		for (; first != last; ++first)
+			if (predicate(*first))
+				break;
+
+		if (first == last)
+			return first;
+
+		Type * result = first;
+
+		for (++first; first != last; ++first)
+			if (!predicate(*first))
+			{
+				*result = stdlib::move(*first);
+				++result;
+			}
+
+		return result;
+	}
+
+	template< typename Type >
+	void sort(Type * first, Type * last)
+	{
+		sort(first, last, less<Type>());
+	}
+
+	template< typename Type, typename Compare >
+	void sort(Type * first, Type * last, Compare compare)
+	{
+		if ((last - first) < 2)
+			return;
+
+		// Twice the number of halvings it takes to get down to one item
+		uint8_t depthLimit = 0;
+
+		for (ptrdiff_t count = (last - first); count > 1; count /= 2)
+			depthLimit += 2;
+
+		details::introsort_loop(first, last, depthLimit, compare);
+		details::insertion_sort(first, last, compare);
+	}
+
+	template< typename Type >
+	const Type * lower_bound(const Type * first, const Type * last, const Type & value)
+	{
+		return lower_bound(first, last, value, less<Type>());
+	}
+
+	template< typename Type, typename Compare >
+	const Type * lower_bound(const Type * first, const Type * last, const Type & value, Compare compare)
+	{
+		for (ptrdiff_t count = (last - first); count > 0;)
+		{
+			const ptrdiff_t half = (count / 2);
+
+			if (compare(first[half], value))
+			{
+				first += (half + 1);
+				count -= (half + 1);
+			}
+			else
+			{
+				count = half;
+			}
+		}
+
+		return first;
+	}
+
+	template< typename Type >
+	const Type * upper_bound(const Type * first, const Type * last, const Type & value)
+	{
+		return upper_bound(first, last, value, less<Type>());
+	}
+
+	template< typename Type, typename Compare >
+	const Type * upper_bound(const Type * first, const Type * last, const Type & value, Compare compare)
+	{
+		for (ptrdiff_t count = (last - first); count > 0;)
+		{
+			const ptrdiff_t half = (count / 2);
+
+			if (!compare(value, first[half]))
+			{
+				first += (half + 1);
+				count -= (half + 1);
+			}
+			else
+			{
+				count = half;
+			}
+		}
+
+		return first;
+	}
+
+	template< typename Type >
+	bool binary_search(const Type * first, const Type * last, const Type & value)
+	{
+		return binary_search(first, last, value, less<Type>());
+	}
+
+	template< typename Type, typename Compare >
+	bool binary_search(const Type * first, const Type * last, const Type & value, Compare compare)
+	{
+		first = lower_bound(first, last, value, compare);
+		return ((first != last) && !compare(value, *first));
+	}
+
+}
\ No newline at end of file
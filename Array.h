@@ -16,16 +16,21 @@
 //  limitations under the License.
 //
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "IntegerTypes.h"
+#include "Algorithm.h"
+#include "BitStorage.h"
+
 //
 // Declarations
 //
 
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 class Array;
 
-template< typename Type, uint8_t capactiyValue >
+template< typename Type, uintmax_t capactiyValue >
 class Array
 {
 public:
@@ -35,16 +40,17 @@ public:
 	//
 
 	static_assert(capactiyValue > 0, "Attempt to create Array with a capacity less than 1");
-	static_assert(capactiyValue < 128, "Attempt to create Array with a capacity greater than 127");
 
 	//
 	// Type Aliases
 	//
 
 	using ValueType = Type;
-	using SizeType = uint8_t;
-	using IndexType = uint8_t;
-	using IndexOfType = int8_t;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
 	
 	//
 	// Constants
@@ -63,6 +69,31 @@ private:
 	
 	ValueType items[capactiy] = {};
 	
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(N)
+	Array() = default;
+
+	// O(N)
+	// Any items not given are value initialised
+	constexpr explicit Array(const ValueType & item)
+		: items { item }
+	{
+	}
+
+	// O(N)
+	// Any items not given are value initialised.
+	// In a constexpr context, a value that doesn't fit ValueType fails to compile.
+	template< typename Other, typename ... Others >
+	constexpr Array(const ValueType & item, const Other & other, const Others & ... others)
+		: items { item, details::convertItem<ValueType>(other), details::convertItem<ValueType>(others) ... }
+	{
+	}
+
 public:
 
 	//
@@ -94,7 +125,7 @@ public:
 	}
 	
 	// O(1)
-	/*constexpr*/ ValueType * getData() noexcept
+	STDLIB_CONSTEXPR14 ValueType * getData() noexcept
 	{
 		return &this->items[FirstIndex];
 	}
@@ -106,31 +137,62 @@ public:
 	}
 	
 	// O(1)
-	ValueType & operator [](const IndexType & index)
+	STDLIB_CONSTEXPR14 ValueType & operator [](const IndexType & index)
 	{
 		return this->items[index];
 	}
 	
 	// O(1)
-	const ValueType & operator [](const IndexType & index) const
+	constexpr const ValueType & operator [](const IndexType & index) const
 	{
 		return this->items[index];
 	}
+
+	// O(1)
+	STDLIB_CONSTEXPR14 Iterator begin() noexcept
+	{
+		return &this->items[FirstIndex];
+	}
+
+	// O(1)
+	constexpr ConstIterator begin() const noexcept
+	{
+		return &this->items[FirstIndex];
+	}
+
+	// O(1)
+	STDLIB_CONSTEXPR14 Iterator end() noexcept
+	{
+		return &this->items[FirstIndex] + capactiy;
+	}
+
+	// O(1)
+	constexpr ConstIterator end() const noexcept
+	{
+		return &this->items[FirstIndex] + capactiy;
+	}
 	
 	// O(N)
 	void clear();
 	
 	// O(N)
-	void fill(const ValueType & item);
+	STDLIB_CONSTEXPR14 void fill(const ValueType & item);
 	
 	// O(N)
-	bool contains(const ValueType & item) const;
+	STDLIB_CONSTEXPR14 bool contains(const ValueType & item) const;
 	
 	// O(N)
-	IndexOfType indexOfFirst(const ValueType & item) const;
+	STDLIB_CONSTEXPR14 IndexOfType indexOfFirst(const ValueType & item) const;
 	
 	// O(N)
-	IndexOfType indexOfLast(const ValueType & item) const;
+	STDLIB_CONSTEXPR14 IndexOfType indexOfLast(const ValueType & item) const;
+
+	// O(N)
+	STDLIB_CONSTEXPR14 SizeType count(const ValueType & item) const;
+
+	// O(N)
+	// Returns the index of the first item that equals any of the count items in set
+	STDLIB_CONSTEXPR14 IndexOfType indexOfAny(const ValueType * set, size_t count) const;
 };
 
 //
@@ -138,7 +200,7 @@ public:
 //
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 void Array<Type, capactiy>::clear()
 {
 	for (IndexType i = 0; i < this->getCount(); ++i)
@@ -146,44 +208,55 @@ void Array<Type, capactiy>::clear()
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
-void Array<Type, capactiy>::fill(const ValueType & item)
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 void Array<Type, capactiy>::fill(const ValueType & item)
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		this->items[i] = item;
+	stdlib::fill(&this->items[FirstIndex], &this->items[FirstIndex] + capactiy, item);
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
-bool Array<Type, capactiy>::contains(const ValueType & item) const
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 bool Array<Type, capactiy>::contains(const ValueType & item) const
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		if (this->items[i] == item)
-			return true;
+	return (this->indexOfFirst(item) != InvalidIndex);
+}
 
-	return false;
+// O(N)
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 auto Array<Type, capactiy>::indexOfFirst(const ValueType & item) const -> IndexOfType
+{
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find(data, data + capactiy, item);
+
+	return (result != (data + capactiy)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
-auto Array<Type, capactiy>::indexOfFirst(const ValueType & item) const -> IndexOfType
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 auto Array<Type, capactiy>::indexOfLast(const ValueType & item) const -> IndexOfType
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		if (this->items[i] == item)
-			return i;
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find_last(data, data + capactiy, item);
 
-	return InvalidIndex;
+	return (result != (data + capactiy)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
-auto Array<Type, capactiy>::indexOfLast(const ValueType & item) const -> IndexOfType
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 auto Array<Type, capactiy>::count(const ValueType & item) const -> SizeType
 {
-	for (IndexType i = this->getCount() - 1; i > 0; --i)
-		if (this->items[i] == item)
-			return i;
+	const ValueType * const data = this->getData();
+	return static_cast<SizeType>(stdlib::count(data, data + capactiy, item));
+}
 
-	return InvalidIndex;
+// O(N)
+template< typename Type, uintmax_t capactiy >
+STDLIB_CONSTEXPR14 auto Array<Type, capactiy>::indexOfAny(const ValueType * set, size_t count) const -> IndexOfType
+{
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find_first_of(data, data + capactiy, set, set + count);
+
+	return (result != (data + capactiy)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
 //
@@ -203,6 +276,8 @@ public:
 	using SizeType = uint8_t;
 	using IndexType = uint8_t;
 	using IndexOfType = int8_t;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
 	
 	//
 	// Constants
@@ -258,6 +333,30 @@ public:
 	
 	// O(1)
 	constexpr const ValueType & operator [](const IndexType & index) const = delete;
+
+	// O(1)
+	/*constexpr*/ Iterator begin() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator begin() const noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	/*constexpr*/ Iterator end() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator end() const noexcept
+	{
+		return nullptr;
+	}
 	
 	// O(1)
 	constexpr void clear() noexcept
@@ -286,4 +385,310 @@ public:
 	{
 		return InvalidIndex;
 	}
+
+	// O(1)
+	constexpr SizeType count(const ValueType & item) const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfAny(const ValueType * set, size_t count) const noexcept
+	{
+		return InvalidIndex;
+	}
+};
+
+//
+// Bool Array
+//
+
+// Stores one bit per item, so it takes an eighth of the memory
+// and is counted and searched a word at a time.
+// operator[] gives a Reference that stands in for a bool &.
+template< uintmax_t capactiyValue >
+class Array<bool, capactiyValue>
+{
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using StorageType = BitStorage<capactiyValue>;
+
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = bool;
+	using WordType = typename StorageType::WordType;
+	using Reference = typename StorageType::Reference;
+	using SizeType = typename StorageType::SizeType;
+	using IndexType = typename StorageType::IndexType;
+	using IndexOfType = typename StorageType::IndexOfType;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = StorageType::capactiy;
+	constexpr static const IndexType FirstIndex = 0;
+	constexpr static const IndexType LastIndex = capactiy - 1;
+	constexpr static const IndexOfType InvalidIndex = -1;
+	constexpr static const uintmax_t WordCount = StorageType::wordCount;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	StorageType items;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(N)
+	Array() = default;
+
+	// O(N)
+	// Any items not given are false
+	constexpr explicit Array(bool item)
+		: items(item)
+	{
+	}
+
+	// O(N)
+	// Any items not given are false.
+	// In a constexpr context, a value other than 0 or 1 fails to compile.
+	template< typename Other, typename ... Others >
+	constexpr Array(bool item, const Other & other, const Others & ... others)
+		: items(item, other, others ...)
+	{
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr bool isFull() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	// The packed words, item N is bit (N % bits per word) of word (N / bits per word)
+	WordType * getWords() noexcept
+	{
+		return this->items.getWords();
+	}
+
+	// O(1)
+	const WordType * getWords() const noexcept
+	{
+		return this->items.getWords();
+	}
+
+	// O(1)
+	Reference operator [](const IndexType & index)
+	{
+		return this->items[index];
+	}
+
+	// O(1)
+	constexpr bool operator [](const IndexType & index) const
+	{
+		return this->items[index];
+	}
+
+	// O(N)
+	// Sets every item to false
+	void clear()
+	{
+		this->items.fill(false);
+	}
+
+	// O(N)
+	void fill(bool item)
+	{
+		this->items.fill(item);
+	}
+
+	// O(N)
+	bool contains(bool item) const
+	{
+		return (this->items.indexOfFirst(item) != InvalidIndex);
+	}
+
+	// O(N)
+	IndexOfType indexOfFirst(bool item) const
+	{
+		return this->items.indexOfFirst(item);
+	}
+
+	// O(N)
+	IndexOfType indexOfLast(bool item) const
+	{
+		return this->items.indexOfLast(item);
+	}
+
+	// O(N)
+	SizeType count(bool item) const
+	{
+		return this->items.count(item);
+	}
+
+	// O(N)
+	// Returns the index of the first item that equals any of the count items in set
+	IndexOfType indexOfAny(const bool * set, size_t count) const;
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< uintmax_t capactiy >
+auto Array<bool, capactiy>::indexOfAny(const bool * set, size_t count) const -> IndexOfType
+{
+	bool anyTrue = false;
+	bool anyFalse = false;
+
+	for (size_t i = 0; i < count; ++i)
+		if (set[i])
+			anyTrue = true;
+		else
+			anyFalse = true;
+
+	if (anyTrue && anyFalse)
+		return 0;
+
+	if (anyTrue || anyFalse)
+		return this->items.indexOfFirst(anyTrue);
+
+	return InvalidIndex;
+}
+
+//
+// Empty Bool Array
+//
+
+// Needed because Array<bool, 0> would match both the bool and the empty specialisations
+template<>
+class Array<bool, 0>
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = bool;
+	using SizeType = uint8_t;
+	using IndexType = uint8_t;
+	using IndexOfType = int8_t;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = 0;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr bool isFull() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	void clear() noexcept
+	{
+	}
+
+	// O(1)
+	void fill(bool) noexcept
+	{
+	}
+
+	// O(1)
+	constexpr bool contains(bool) const noexcept
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfFirst(bool) const noexcept
+	{
+		return InvalidIndex;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfLast(bool) const noexcept
+	{
+		return InvalidIndex;
+	}
+
+	// O(1)
+	constexpr SizeType count(bool) const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfAny(const bool *, size_t) const noexcept
+	{
+		return InvalidIndex;
+	}
 };
\ No newline at end of file
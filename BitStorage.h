@@ -0,0 +1,340 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+#include <string.h>
+
+#include "IntegerTypes.h"
+
+//
+// Bit Word Type
+//
+
+// The word that packed bits are stored and scanned in.
+// AVR works a byte at a time, so anything wider would only cost extra padding.
+#if defined(__AVR__)
+using BitWordType = uint8_t;
+#else
+using BitWordType = uintptr_t;
+#endif
+
+//
+// Bit Functions
+//
+
+namespace details
+{
+	// The builtins take at least an unsigned int,
+	// so narrower words are widened and wider words pick the matching builtin
+
+	template< typename Word >
+	inline uint8_t countBits(Word word) noexcept
+	{
+		return (sizeof(Word) <= sizeof(unsigned int)) ? __builtin_popcount(static_cast<unsigned int>(word)) :
+			(sizeof(Word) <= sizeof(unsigned long)) ? __builtin_popcountl(static_cast<unsigned long>(word)) :
+			__builtin_popcountll(static_cast<unsigned long long>(word));
+	}
+
+	// word must not be 0
+	template< typename Word >
+	inline uint8_t lowestBit(Word word) noexcept
+	{
+		return (sizeof(Word) <= sizeof(unsigned int)) ? __builtin_ctz(static_cast<unsigned int>(word)) :
+			(sizeof(Word) <= sizeof(unsigned long)) ? __builtin_ctzl(static_cast<unsigned long>(word)) :
+			__builtin_ctzll(static_cast<unsigned long long>(word));
+	}
+
+	// word must not be 0
+	template< typename Word >
+	inline uint8_t highestBit(Word word) noexcept
+	{
+		return (sizeof(Word) <= sizeof(unsigned int)) ? ((sizeof(unsigned int) * 8) - 1 - __builtin_clz(static_cast<unsigned int>(word))) :
+			(sizeof(Word) <= sizeof(unsigned long)) ? ((sizeof(unsigned long) * 8) - 1 - __builtin_clzl(static_cast<unsigned long>(word))) :
+			((sizeof(unsigned long long) * 8) - 1 - __builtin_clzll(static_cast<unsigned long long>(word)));
+	}
+
+	// O(N)
+	// The word at wordIndex of the given bits, where the first bit given is bit number bitIndex
+	template< typename Word >
+	constexpr Word packBitWord(uintmax_t, uintmax_t) noexcept
+	{
+		return 0;
+	}
+
+	// O(N)
+	template< typename Word, typename ... Bits >
+	constexpr Word packBitWord(uintmax_t wordIndex, uintmax_t bitIndex, bool bit, Bits ... bits) noexcept
+	{
+		return static_cast<Word>((((bitIndex / (sizeof(Word) * 8)) == wordIndex) && bit) ? (static_cast<Word>(1) << (bitIndex % (sizeof(Word) * 8))) : 0) |
+			packBitWord<Word>(wordIndex, bitIndex + 1, bits...);
+	}
+
+	// The indices of the words in a BitStorage,
+	// so that a constructor can pack each word in its member initialiser
+	template< uintmax_t ... wordIndices >
+	struct BitWordIndices
+	{
+	};
+
+	template< uintmax_t count, uintmax_t ... wordIndices >
+	struct MakeBitWordIndices : MakeBitWordIndices<count - 1, count - 1, wordIndices ...>
+	{
+	};
+
+	template< uintmax_t ... wordIndices >
+	struct MakeBitWordIndices<0, wordIndices ...>
+	{
+		using Type = BitWordIndices<wordIndices ...>;
+	};
+}
+
+//
+// Declarations
+//
+
+template< uintmax_t capactiy >
+class BitStorage;
+
+// capactiy bits packed into words.
+// Any bits in the last word past the capacity are always kept clear,
+// so whole words can be counted and scanned without masking.
+template< uintmax_t capactiyValue >
+class BitStorage
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create BitStorage with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using WordType = BitWordType;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+	constexpr static const uintmax_t bitsPerWord = (sizeof(WordType) * 8);
+	constexpr static const uintmax_t wordCount = ((capactiyValue + bitsPerWord - 1) / bitsPerWord);
+
+	//
+	// Reference
+	//
+
+	// Stands in for a bool & to a single bit
+	class Reference
+	{
+	private:
+		WordType & word;
+		WordType mask;
+
+	public:
+		Reference(WordType & word, WordType mask) noexcept
+			: word(word), mask(mask)
+		{
+		}
+
+		operator bool() const noexcept
+		{
+			return ((this->word & this->mask) != 0);
+		}
+
+		Reference & operator =(bool value) noexcept
+		{
+			if (value)
+				this->word |= this->mask;
+			else
+				this->word &= static_cast<WordType>(~this->mask);
+
+			return *this;
+		}
+
+		Reference & operator =(const Reference & other) noexcept
+		{
+			return (*this = static_cast<bool>(other));
+		}
+
+		void flip() noexcept
+		{
+			this->word ^= this->mask;
+		}
+	};
+
+private:
+
+	//
+	// Constants
+	//
+
+	constexpr static const uintmax_t lastWordBits = (capactiyValue % bitsPerWord);
+	constexpr static const WordType lastWordMask = (lastWordBits == 0) ? static_cast<WordType>(~static_cast<WordType>(0)) : static_cast<WordType>((static_cast<WordType>(1) << lastWordBits) - 1);
+
+	//
+	// Member Variables
+	//
+
+	WordType words[wordCount] = {};
+
+	//
+	// Private Constructors
+	//
+
+	// O(N)
+	template< uintmax_t ... wordIndices, typename ... Items >
+	constexpr BitStorage(details::BitWordIndices<wordIndices ...>, const Items & ... items) noexcept
+		: words { details::packBitWord<WordType>(wordIndices, 0, details::convertItem<bool>(items) ...) ... }
+	{
+	}
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	constexpr static WordType getMask(IndexType index) noexcept
+	{
+		return static_cast<WordType>(static_cast<WordType>(1) << (index % bitsPerWord));
+	}
+
+	// O(1)
+	// The word with every bit that equals value set
+	WordType getMatches(uintmax_t wordIndex, bool value) const noexcept
+	{
+		return value ? this->words[wordIndex] : static_cast<WordType>(~this->words[wordIndex] & ((wordIndex == (wordCount - 1)) ? lastWordMask : static_cast<WordType>(~static_cast<WordType>(0))));
+	}
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(N)
+	BitStorage() = default;
+
+	// O(N)
+	// Bits are given in order, any not given are false.
+	// In a constexpr context, a value other than 0 or 1 fails to compile.
+	template< typename Item, typename ... Items >
+	constexpr explicit BitStorage(const Item & item, const Items & ... items) noexcept
+		: BitStorage(typename details::MakeBitWordIndices<wordCount>::Type(), item, items ...)
+	{
+		static_assert(sizeof...(Items) < capactiyValue, "Too many bits given to BitStorage");
+	}
+
+	//
+	// Member Functions
+	//
+
+	// O(1)
+	WordType * getWords() noexcept
+	{
+		return &this->words[0];
+	}
+
+	// O(1)
+	const WordType * getWords() const noexcept
+	{
+		return &this->words[0];
+	}
+
+	// O(1)
+	Reference operator [](IndexType index) noexcept
+	{
+		return Reference(this->words[index / bitsPerWord], getMask(index));
+	}
+
+	// O(1)
+	constexpr bool operator [](IndexType index) const noexcept
+	{
+		return ((this->words[index / bitsPerWord] & getMask(index)) != 0);
+	}
+
+	// O(N)
+	void fill(bool value) noexcept
+	{
+		memset(&this->words[0], value ? 0xFF : 0x00, sizeof(this->words));
+		this->words[wordCount - 1] &= lastWordMask;
+	}
+
+	// O(N)
+	SizeType count(bool value) const noexcept;
+
+	// O(N)
+	IndexOfType indexOfFirst(bool value) const noexcept;
+
+	// O(N)
+	IndexOfType indexOfLast(bool value) const noexcept;
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< uintmax_t capactiy >
+auto BitStorage<capactiy>::count(bool value) const noexcept -> SizeType
+{
+	SizeType result = 0;
+
+	for (uintmax_t index = 0; index < wordCount; ++index)
+		result += details::countBits(this->words[index]);
+
+	return value ? result : static_cast<SizeType>(capactiy - result);
+}
+
+// O(N)
+template< uintmax_t capactiy >
+auto BitStorage<capactiy>::indexOfFirst(bool value) const noexcept -> IndexOfType
+{
+	for (uintmax_t index = 0; index < wordCount; ++index)
+	{
+		const WordType matches = this->getMatches(index, value);
+
+		if (matches != 0)
+			return static_cast<IndexOfType>((index * bitsPerWord) + details::lowestBit(matches));
+	}
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< uintmax_t capactiy >
+auto BitStorage<capactiy>::indexOfLast(bool value) const noexcept -> IndexOfType
+{
+	for (uintmax_t index = wordCount; index > 0; --index)
+	{
+		const WordType matches = this->getMatches(index - 1, value);
+
+		if (matches != 0)
+			return static_cast<IndexOfType>(((index - 1) * bitsPerWord) + details::highestBit(matches));
+	}
+
+	return InvalidIndex;
+}
\ No newline at end of file
@@ -0,0 +1,1138 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Algorithm.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy >
+class CircularDeque;
+
+template< typename Type, uintmax_t capactiyValue >
+class CircularDeque
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create CircularDeque with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const IndexOfType InvalidIndex = -1;
+	constexpr static const IndexType FirstIndex = 0;
+	constexpr static const IndexType LastIndex = capactiy - 1;
+
+	//
+	// Iterators
+	//
+
+	// Walks the items from first to last, jumping from the end of the buffer back to its start.
+	// Iterators compare by how many items are left rather than by position,
+	// because the first slot of a full deque is also its past-the-end slot.
+	template< typename Value >
+	class BasicIterator
+	{
+	private:
+		Value * item;
+		Value * buffer;
+		SizeType remaining;
+
+	public:
+		BasicIterator(Value * item, Value * buffer, SizeType remaining) noexcept
+			: item(item), buffer(buffer), remaining(remaining)
+		{
+		}
+
+		operator BasicIterator<const Value>() const noexcept
+		{
+			return BasicIterator<const Value>(this->item, this->buffer, this->remaining);
+		}
+
+		Value & operator *() const noexcept
+		{
+			return *this->item;
+		}
+
+		Value * operator ->() const noexcept
+		{
+			return this->item;
+		}
+
+		BasicIterator & operator ++() noexcept
+		{
+			++this->item;
+
+			if (this->item == (this->buffer + capactiy))
+				this->item = this->buffer;
+
+			--this->remaining;
+			return *this;
+		}
+
+		BasicIterator operator ++(int) noexcept
+		{
+			const BasicIterator result = *this;
+			++*this;
+			return result;
+		}
+
+		bool operator ==(const BasicIterator & other) const noexcept
+		{
+			return (this->remaining == other.remaining);
+		}
+
+		bool operator !=(const BasicIterator & other) const noexcept
+		{
+			return (this->remaining != other.remaining);
+		}
+	};
+
+	using Iterator = BasicIterator<ValueType>;
+	using ConstIterator = BasicIterator<const ValueType>;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	UninitialisedStorage<ValueType, capactiy> items;
+	IndexType head = 0;
+	SizeType itemCount = 0;
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	// Maps an index relative to the first item onto an index into items
+	IndexType wrapIndex(IndexType index) const noexcept
+	{
+		return (index < (capactiy - this->head)) ? (this->head + index) : (index - (capactiy - this->head));
+	}
+
+	// O(1)
+	bool isWrapped() const noexcept
+	{
+		return (this->itemCount > (capactiy - this->head));
+	}
+
+	// O(1)
+	// The number of the count items starting at index that come before the end of the buffer
+	SizeType getRunLength(IndexType index, SizeType count) const noexcept
+	{
+		return (count < (capactiy - index)) ? count : (capactiy - index);
+	}
+
+	// O(N)
+	void reverseRange(IndexType first, IndexType last);
+
+	// O(N)
+	void linearise();
+
+public:
+
+	//
+	// Constructors, Destructor and Assignment
+	//
+
+	CircularDeque() = default;
+
+	// O(N)
+	CircularDeque(const CircularDeque & other);
+
+	// O(N)
+	CircularDeque(CircularDeque && other);
+
+	// O(N)
+	~CircularDeque()
+	{
+		this->clear();
+	}
+
+	// O(N)
+	CircularDeque & operator =(const CircularDeque & other);
+
+	// O(N)
+	CircularDeque & operator =(CircularDeque && other);
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return (this->itemCount == 0);
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return (this->itemCount == capactiy);
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->itemCount;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1) if the items do not wrap around the end of the buffer, otherwise O(N)
+	// Rearranges the items into a contiguous block, which invalidates references
+	ValueType * getData();
+
+	// The items may wrap around the end of the buffer,
+	// so there is no contiguous block to return without rearranging them
+	const ValueType * getData() const = delete;
+
+	// O(1)
+	ValueType & operator [](IndexType index)
+	{
+		return this->items[this->wrapIndex(index)];
+	}
+
+	// O(1)
+	const ValueType & operator [](IndexType index) const
+	{
+		return this->items[this->wrapIndex(index)];
+	}
+
+	// O(1)
+	Iterator begin() noexcept
+	{
+		return Iterator(this->items.getData() + this->head, this->items.getData(), this->itemCount);
+	}
+
+	// O(1)
+	ConstIterator begin() const noexcept
+	{
+		return ConstIterator(this->items.getData() + this->head, this->items.getData(), this->itemCount);
+	}
+
+	// O(1)
+	Iterator end() noexcept
+	{
+		return Iterator(this->items.getData() + this->head, this->items.getData(), 0);
+	}
+
+	// O(1)
+	ConstIterator end() const noexcept
+	{
+		return ConstIterator(this->items.getData() + this->head, this->items.getData(), 0);
+	}
+
+	// O(N)
+	void clear();
+
+	// O(N)
+	void fill(const ValueType & item);
+
+	// O(N)
+	bool contains(const ValueType & item) const;
+
+	// O(N)
+	IndexOfType indexOfFirst(const ValueType & item) const;
+
+	// O(N)
+	IndexOfType indexOfLast(const ValueType & item) const;
+
+	// O(N)
+	SizeType count(const ValueType & item) const;
+
+	// O(N)
+	// Returns the index of the first item that equals any of the count items in set
+	IndexOfType indexOfAny(const ValueType * set, size_t count) const;
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	ValueType & getFirst()
+	{
+		return this->items[this->head];
+	}
+
+	// O(1)
+	const ValueType & getFirst() const
+	{
+		return this->items[this->head];
+	}
+
+	// O(1)
+	ValueType & getLast()
+	{
+		return this->items[this->wrapIndex(this->itemCount - 1)];
+	}
+
+	// O(1)
+	const ValueType & getLast() const
+	{
+		return this->items[this->wrapIndex(this->itemCount - 1)];
+	}
+
+	// O(1)
+	bool append(const ValueType & item)
+	{
+		return this->emplaceBack(item);
+	}
+
+	// O(1)
+	bool append(ValueType && item)
+	{
+		return this->emplaceBack(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplaceBack(Arguments && ... arguments);
+
+	// O(1)
+	bool prepend(const ValueType & item)
+	{
+		return this->emplaceFront(item);
+	}
+
+	// O(1)
+	bool prepend(ValueType && item)
+	{
+		return this->emplaceFront(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplaceFront(Arguments && ... arguments);
+
+	// O(1)
+	void unappend();
+
+	// O(1)
+	void unprepend();
+
+	// O(N)
+	// Appends as many items as will fit, returns the number appended
+	SizeType appendRange(const ValueType * source, SizeType count);
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType appendRange(const OtherContainer & container)
+	{
+		const auto count = container.getCount();
+		return this->appendRange(container.getData(), (count < capactiy) ? static_cast<SizeType>(count) : capactiy);
+	}
+
+	// O(N)
+	// Prepends as many items as will fit, keeping their order, returns the number prepended
+	SizeType prependRange(const ValueType * source, SizeType count);
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType prependRange(const OtherContainer & container)
+	{
+		const auto count = container.getCount();
+		return this->prependRange(container.getData(), (count < capactiy) ? static_cast<SizeType>(count) : capactiy);
+	}
+
+	// O(N)
+	// Moves up to count items from the end into destination, keeping their order,
+	// returns the number moved
+	SizeType unappendInto(ValueType * destination, SizeType count);
+
+	// O(N)
+	// Moves up to count items from the start into destination, keeping their order,
+	// returns the number moved
+	SizeType unprependInto(ValueType * destination, SizeType count);
+
+	// O(N)
+	bool removeFirst(const ValueType & item);
+
+	// O(N)
+	bool removeLast(const ValueType & item);
+
+	// O(N)
+	bool removeAt(IndexType index);
+
+	// O(N)
+	bool insert(IndexType index, const ValueType & item)
+	{
+		return this->emplaceAt(index, item);
+	}
+
+	// O(N)
+	bool insert(IndexType index, ValueType && item)
+	{
+		return this->emplaceAt(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceAt(IndexType index, Arguments && ... arguments);
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+CircularDeque<Type, capactiy>::CircularDeque(const CircularDeque & other)
+{
+	for (IndexType i = 0; i < other.itemCount; ++i)
+		this->items.construct(i, other[i]);
+
+	this->itemCount = other.itemCount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+CircularDeque<Type, capactiy>::CircularDeque(CircularDeque && other)
+{
+	for (IndexType i = 0; i < other.itemCount; ++i)
+		this->items.construct(i, stdlib::move(other[i]));
+
+	this->itemCount = other.itemCount;
+	other.clear();
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::operator =(const CircularDeque & other) -> CircularDeque &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType i = 0; i < other.itemCount; ++i)
+			this->items.construct(i, other[i]);
+
+		this->itemCount = other.itemCount;
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::operator =(CircularDeque && other) -> CircularDeque &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType i = 0; i < other.itemCount; ++i)
+			this->items.construct(i, stdlib::move(other[i]));
+
+		this->itemCount = other.itemCount;
+		other.clear();
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::reverseRange(IndexType first, IndexType last)
+{
+	for (; (first + 1) < last; ++first, --last)
+		stdlib::swap(this->items[first], this->items[last - 1]);
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::linearise()
+{
+	const SizeType frontCount = (capactiy - this->head);
+	const SizeType backCount = (this->itemCount - frontCount);
+
+	// Close the gap (if there is one) so the front items directly follow the back items,
+	// constructing into the empty slots and assigning over the moved-from ones
+	if (backCount < this->head)
+	{
+		for (IndexType i = 0; i < frontCount; ++i)
+		{
+			const IndexType target = (backCount + i);
+
+			if (target < this->head)
+				this->items.construct(target, stdlib::move(this->items[this->head + i]));
+			else
+				this->items[target] = stdlib::move(this->items[this->head + i]);
+		}
+
+		// Destroy the moved-from items left past the end
+		for (IndexType i = ((this->itemCount > this->head) ? this->itemCount : this->head); i < capactiy; ++i)
+			this->items.destroy(i);
+	}
+
+	// Rotate the back items behind the front items
+	this->reverseRange(0, backCount);
+	this->reverseRange(backCount, this->itemCount);
+	this->reverseRange(0, this->itemCount);
+
+	this->head = 0;
+}
+
+// O(1) if the items do not wrap around the end of the buffer, otherwise O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::getData() -> ValueType *
+{
+	if (this->isWrapped())
+		this->linearise();
+
+	return &this->items[this->head];
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::clear()
+{
+	ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, this->itemCount);
+
+	stdlib::destroy(data + this->head, data + this->head + firstRun);
+	stdlib::destroy(data, data + (this->itemCount - firstRun));
+
+	this->head = 0;
+	this->itemCount = 0;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::fill(const ValueType & item)
+{
+	ValueType * const data = this->items.getData();
+
+	// The items occupy at most two contiguous runs
+	if (this->isWrapped())
+	{
+		stdlib::fill(data + this->head, data + capactiy, item);
+		stdlib::fill(data, data + (this->itemCount - (capactiy - this->head)), item);
+	}
+	else
+	{
+		stdlib::fill(data + this->head, data + this->head + this->itemCount, item);
+	}
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+bool CircularDeque<Type, capactiy>::contains(const ValueType & item) const
+{
+	return (this->indexOfFirst(item) != InvalidIndex);
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::indexOfFirst(const ValueType & item) const -> IndexOfType
+{
+	const ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, this->itemCount);
+
+	const ValueType * const first = stdlib::find(data + this->head, data + this->head + firstRun, item);
+
+	if (first != (data + this->head + firstRun))
+		return static_cast<IndexOfType>(first - (data + this->head));
+
+	const ValueType * const second = stdlib::find(data, data + (this->itemCount - firstRun), item);
+
+	if (second != (data + (this->itemCount - firstRun)))
+		return static_cast<IndexOfType>(firstRun + (second - data));
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::indexOfLast(const ValueType & item) const -> IndexOfType
+{
+	const ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, this->itemCount);
+
+	const ValueType * const second = stdlib::find_last(data, data + (this->itemCount - firstRun), item);
+
+	if (second != (data + (this->itemCount - firstRun)))
+		return static_cast<IndexOfType>(firstRun + (second - data));
+
+	const ValueType * const first = stdlib::find_last(data + this->head, data + this->head + firstRun, item);
+
+	if (first != (data + this->head + firstRun))
+		return static_cast<IndexOfType>(first - (data + this->head));
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::count(const ValueType & item) const -> SizeType
+{
+	const ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, this->itemCount);
+
+	return static_cast<SizeType>(stdlib::count(data + this->head, data + this->head + firstRun, item) + stdlib::count(data, data + (this->itemCount - firstRun), item));
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::indexOfAny(const ValueType * set, size_t count) const -> IndexOfType
+{
+	const ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, this->itemCount);
+
+	const ValueType * const first = stdlib::find_first_of(data + this->head, data + this->head + firstRun, set, set + count);
+
+	if (first != (data + this->head + firstRun))
+		return static_cast<IndexOfType>(first - (data + this->head));
+
+	const ValueType * const second = stdlib::find_first_of(data, data + (this->itemCount - firstRun), set, set + count);
+
+	if (second != (data + (this->itemCount - firstRun)))
+		return static_cast<IndexOfType>(firstRun + (second - data));
+
+	return InvalidIndex;
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool CircularDeque<Type, capactiy>::emplaceBack(Arguments && ... arguments)
+{
+	if (this->isFull())
+		return false;
+
+	this->items.construct(this->wrapIndex(this->itemCount), stdlib::forward<Arguments>(arguments)...);
+	++this->itemCount;
+	return true;
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool CircularDeque<Type, capactiy>::emplaceFront(Arguments && ... arguments)
+{
+	if (this->isFull())
+		return false;
+
+	const IndexType previous = (this->head > FirstIndex) ? (this->head - 1) : LastIndex;
+	this->items.construct(previous, stdlib::forward<Arguments>(arguments)...);
+	this->head = previous;
+	++this->itemCount;
+	return true;
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::unappend()
+{
+	if (this->isEmpty())
+		return;
+
+	--this->itemCount;
+	this->items.destroy(this->wrapIndex(this->itemCount));
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+void CircularDeque<Type, capactiy>::unprepend()
+{
+	if (this->isEmpty())
+		return;
+
+	this->items.destroy(this->head);
+	this->head = (this->head < LastIndex) ? (this->head + 1) : FirstIndex;
+	--this->itemCount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::appendRange(const ValueType * source, SizeType count) -> SizeType
+{
+	const SizeType space = (capactiy - this->itemCount);
+	const SizeType amount = (count < space) ? count : space;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const IndexType start = this->wrapIndex(this->itemCount);
+	const SizeType firstRun = this->getRunLength(start, amount);
+
+	stdlib::uninitialized_copy(source, source + firstRun, data + start);
+	stdlib::uninitialized_copy(source + firstRun, source + amount, data);
+
+	this->itemCount += amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::prependRange(const ValueType * source, SizeType count) -> SizeType
+{
+	const SizeType space = (capactiy - this->itemCount);
+	const SizeType amount = (count < space) ? count : space;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const IndexType start = (this->head >= amount) ? (this->head - amount) : (this->head + (capactiy - amount));
+	const SizeType firstRun = this->getRunLength(start, amount);
+
+	stdlib::uninitialized_copy(source, source + firstRun, data + start);
+	stdlib::uninitialized_copy(source + firstRun, source + amount, data);
+
+	this->head = start;
+	this->itemCount += amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::unappendInto(ValueType * destination, SizeType count) -> SizeType
+{
+	const SizeType amount = (count < this->itemCount) ? count : this->itemCount;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const IndexType start = this->wrapIndex(this->itemCount - amount);
+	const SizeType firstRun = this->getRunLength(start, amount);
+
+	stdlib::move(data + start, data + start + firstRun, destination);
+	stdlib::move(data, data + (amount - firstRun), destination + firstRun);
+
+	stdlib::destroy(data + start, data + start + firstRun);
+	stdlib::destroy(data, data + (amount - firstRun));
+
+	this->itemCount -= amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto CircularDeque<Type, capactiy>::unprependInto(ValueType * destination, SizeType count) -> SizeType
+{
+	const SizeType amount = (count < this->itemCount) ? count : this->itemCount;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const SizeType firstRun = this->getRunLength(this->head, amount);
+
+	stdlib::move(data + this->head, data + this->head + firstRun, destination);
+	stdlib::move(data, data + (amount - firstRun), destination + firstRun);
+
+	stdlib::destroy(data + this->head, data + this->head + firstRun);
+	stdlib::destroy(data, data + (amount - firstRun));
+
+	this->head = this->wrapIndex(amount);
+	this->itemCount -= amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+bool CircularDeque<Type, capactiy>::removeFirst(const ValueType & item)
+{
+	const IndexOfType index = this->indexOfFirst(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAt(static_cast<IndexType>(index));
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+bool CircularDeque<Type, capactiy>::removeLast(const ValueType & item)
+{
+	const IndexOfType index = this->indexOfLast(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAt(static_cast<IndexType>(index));
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+bool CircularDeque<Type, capactiy>::removeAt(IndexType index)
+{
+	if (index >= this->itemCount)
+		return false;
+
+	// Shift whichever side of the index has fewer items
+	if (index < (this->itemCount / 2))
+	{
+		for (IndexType i = index; i > 0; --i)
+			(*this)[i] = stdlib::move((*this)[i - 1]);
+
+		this->unprepend();
+	}
+	else
+	{
+		for (IndexType i = index + 1; i < this->itemCount; ++i)
+			(*this)[i - 1] = stdlib::move((*this)[i]);
+
+		this->unappend();
+	}
+
+	return true;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool CircularDeque<Type, capactiy>::emplaceAt(IndexType index, Arguments && ... arguments)
+{
+	if (index > this->itemCount)
+		return false;
+
+	if (this->isFull())
+		return false;
+
+	if (index == 0)
+		return this->emplaceFront(stdlib::forward<Arguments>(arguments)...);
+
+	if (index == this->itemCount)
+		return this->emplaceBack(stdlib::forward<Arguments>(arguments)...);
+
+	// Build the item before shifting in case the arguments refer to an item
+	ValueType item(stdlib::forward<Arguments>(arguments)...);
+
+	// Shift whichever side of the index has fewer items,
+	// moving the outermost item into the empty slot first
+	if (index < (this->itemCount / 2))
+	{
+		this->head = (this->head > FirstIndex) ? (this->head - 1) : LastIndex;
+		++this->itemCount;
+
+		this->items.construct(this->head, stdlib::move((*this)[1]));
+
+		for (IndexType i = 1; i < index; ++i)
+			(*this)[i] = stdlib::move((*this)[i + 1]);
+	}
+	else
+	{
+		this->items.construct(this->wrapIndex(this->itemCount), stdlib::move((*this)[this->itemCount - 1]));
+		++this->itemCount;
+
+		for (IndexType i = this->itemCount - 2; i > index; --i)
+			(*this)[i] = stdlib::move((*this)[i - 1]);
+	}
+
+	(*this)[index] = stdlib::move(item);
+	return true;
+}
+
+//
+// Empty CircularDeque
+//
+
+template< typename Type >
+class CircularDeque<Type, 0>
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = uint8_t;
+	using IndexType = uint8_t;
+	using IndexOfType = int8_t;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = 0;
+	constexpr static const IndexOfType InvalidIndex = -1;
+	constexpr static const IndexType FirstIndex = InvalidIndex;
+	constexpr static const IndexType LastIndex = InvalidIndex;
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr bool isFull() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	/*constexpr*/ ValueType * getData() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr const ValueType * getData() const noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	/*constexpr*/ ValueType & operator [](IndexType index) = delete;
+
+	// O(1)
+	constexpr const ValueType & operator [](IndexType index) const = delete;
+
+	// O(1)
+	/*constexpr*/ Iterator begin() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator begin() const noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	/*constexpr*/ Iterator end() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator end() const noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr void clear() noexcept
+	{
+	}
+
+	// O(1)
+	constexpr void fill(const ValueType & item) noexcept
+	{
+	}
+
+	// O(1)
+	constexpr bool contains(const ValueType & item) const noexcept
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfFirst(const ValueType & item) const noexcept
+	{
+		return InvalidIndex;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfLast(const ValueType & item) const noexcept
+	{
+		return InvalidIndex;
+	}
+
+	// O(1)
+	constexpr SizeType count(const ValueType & item) const noexcept
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr IndexOfType indexOfAny(const ValueType * set, size_t count) const noexcept
+	{
+		return InvalidIndex;
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	/*constexpr*/ ValueType & getFirst() = delete;
+
+	// O(1)
+	constexpr const ValueType & getFirst() const = delete;
+
+	// O(1)
+	/*constexpr*/ ValueType & getLast() = delete;
+
+	// O(1)
+	constexpr const ValueType & getLast() const = delete;
+
+	// O(1)
+	constexpr bool append(const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	constexpr bool emplaceBack(Arguments && ... arguments)
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr bool prepend(const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	constexpr bool emplaceFront(Arguments && ... arguments)
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr void unappend()
+	{
+	}
+
+	// O(1)
+	constexpr void unprepend()
+	{
+	}
+
+	// O(1)
+	constexpr SizeType appendRange(const ValueType * source, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	template< typename OtherContainer >
+	constexpr SizeType appendRange(const OtherContainer & container)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType prependRange(const ValueType * source, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	template< typename OtherContainer >
+	constexpr SizeType prependRange(const OtherContainer & container)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType unappendInto(ValueType * destination, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType unprependInto(ValueType * destination, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(N)
+	constexpr bool removeFirst(const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(N)
+	constexpr bool removeLast(const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(N)
+	constexpr bool removeAt(IndexType index)
+	{
+		return false;
+	}
+
+	// O(N)
+	constexpr bool insert(IndexType index, const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	constexpr bool emplaceAt(IndexType index, Arguments && ... arguments)
+	{
+		return false;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,351 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Algorithms for any container with getData() and getCount(),
+// such as Array, List, Stack, Deque and CircularDeque.
+// getData() must point at getCount() items of ValueType,
+// so the packed containers, which give getWords() or getBytes() instead, are not accepted.
+// A CircularDeque is made contiguous first, so it must not be const.
+
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Utility.h"
+#include "Algorithm.h"
+#include "Functional.h"
+#include "Array.h"
+
+//
+// Constraints
+//
+
+namespace details
+{
+	// Only valid for a container whose getData() gives a pointer to its ValueType.
+	// Used as a default template argument, so the algorithms below
+	// are never picked for an unrelated type that happens to share their names.
+
+	template< typename Container >
+	using ContainerItems = decltype(stdlib::declval<typename Container::ValueType * &>() = stdlib::declval<Container &>().getData());
+
+	template< typename Container >
+	using ConstContainerItems = decltype(stdlib::declval<const typename Container::ValueType * &>() = stdlib::declval<const Container &>().getData());
+}
+
+//
+// Sorting Networks
+//
+
+// Arrays no bigger than this are sorted with a sorting network
+constexpr uintmax_t NetworkSortMaxCount = 16;
+
+namespace details
+{
+	// Batcher's odd-even merge sort, written as four nested loops over p, k, j and i.
+	// Every loop bound is known at compile time, so each level is unrolled by recursion
+	// and what remains is a fixed sequence of compare-exchanges on constant indices.
+
+	// Small trivially copyable items are selected rather than swapped,
+	// which the compiler can do without a branch
+	template< typename Type, typename Compare >
+	void compareExchange(Type & left, Type & right, Compare & compare, stdlib::true_type)
+	{
+		const bool outOfOrder = compare(right, left);
+		const Type first = outOfOrder ? right : left;
+		const Type second = outOfOrder ? left : right;
+		left = first;
+		right = second;
+	}
+
+	template< typename Type, typename Compare >
+	void compareExchange(Type & left, Type & right, Compare & compare, stdlib::false_type)
+	{
+		if (compare(right, left))
+			stdlib::swap(left, right);
+	}
+
+	template< typename Type >
+	using IsNetworkSelectable = stdlib::bool_constant<(stdlib::is_trivially_copyable<Type>::value && (sizeof(Type) <= sizeof(uintmax_t)))>;
+
+	template< bool sameBlock >
+	struct NetworkCompareExchange
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type & left, Type & right, Compare & compare)
+		{
+			compareExchange(left, right, compare, IsNetworkSelectable<Type>());
+		}
+	};
+
+	template<>
+	struct NetworkCompareExchange<false>
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type &, Type &, Compare &)
+		{
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k, uintmax_t j, uintmax_t i, bool active = ((i < k) && ((i + j + k) < count)) >
+	struct NetworkLoopI
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type * data, Compare & compare)
+		{
+			NetworkCompareExchange<(((i + j) / (p * 2)) == ((i + j + k) / (p * 2)))>::apply(data[i + j], data[i + j + k], compare);
+			NetworkLoopI<count, p, k, j, (i + 1)>::apply(data, compare);
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k, uintmax_t j, uintmax_t i >
+	struct NetworkLoopI<count, p, k, j, i, false>
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type *, Compare &)
+		{
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k, uintmax_t j, bool active = ((j + k) < count) >
+	struct NetworkLoopJ
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type * data, Compare & compare)
+		{
+			NetworkLoopI<count, p, k, j, 0>::apply(data, compare);
+			NetworkLoopJ<count, p, k, (j + (k * 2))>::apply(data, compare);
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k, uintmax_t j >
+	struct NetworkLoopJ<count, p, k, j, false>
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type *, Compare &)
+		{
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k, bool active = (k >= 1) >
+	struct NetworkLoopK
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type * data, Compare & compare)
+		{
+			NetworkLoopJ<count, p, k, (k % p)>::apply(data, compare);
+			NetworkLoopK<count, p, (k / 2)>::apply(data, compare);
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, uintmax_t k >
+	struct NetworkLoopK<count, p, k, false>
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type *, Compare &)
+		{
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p, bool active = (p < count) >
+	struct NetworkLoopP
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type * data, Compare & compare)
+		{
+			NetworkLoopK<count, p, p>::apply(data, compare);
+			NetworkLoopP<count, (p * 2)>::apply(data, compare);
+		}
+	};
+
+	template< uintmax_t count, uintmax_t p >
+	struct NetworkLoopP<count, p, false>
+	{
+		template< typename Type, typename Compare >
+		static void apply(Type *, Compare &)
+		{
+		}
+	};
+
+	template< uintmax_t capactiy, typename Type, typename Compare >
+	void sortArray(Type * data, Compare & compare, stdlib::true_type)
+	{
+		NetworkLoopP<capactiy, 1>::apply(data, compare);
+	}
+
+	template< uintmax_t capactiy, typename Type, typename Compare >
+	void sortArray(Type * data, Compare & compare, stdlib::false_type)
+	{
+		stdlib::sort(data, data + capactiy, compare);
+	}
+}
+
+// Sorts exactly count items with a sorting network generated at compile time.
+// Best for small counts, where it avoids all of sort's branching on the count.
+template< uintmax_t count, typename Type, typename Compare >
+void networkSort(Type * data, Compare compare)
+{
+	details::NetworkLoopP<count, 1>::apply(data, compare);
+}
+
+template< uintmax_t count, typename Type >
+void networkSort(Type * data)
+{
+	networkSort<count>(data, stdlib::less<Type>());
+}
+
+//
+// Sorting
+//
+
+// O(N log N)
+template< typename Container, typename Compare, typename = details::ContainerItems<Container> >
+void sort(Container & container, Compare compare)
+{
+	using ValueType = typename Container::ValueType;
+
+	ValueType * const data = container.getData();
+	stdlib::sort(data, data + container.getCount(), compare);
+}
+
+// O(N log N)
+template< typename Container, typename = details::ContainerItems<Container> >
+void sort(Container & container)
+{
+	sort(container, stdlib::less<typename Container::ValueType>());
+}
+
+// O(N log N)
+// Small arrays have a fixed count, so they use a sorting network
+template< typename Type, uintmax_t capactiy, typename Compare, typename = details::ContainerItems<Array<Type, capactiy>> >
+void sort(Array<Type, capactiy> & array, Compare compare)
+{
+	details::sortArray<capactiy>(array.getData(), compare, stdlib::bool_constant<(capactiy <= NetworkSortMaxCount)>());
+}
+
+// O(N log N)
+template< typename Type, uintmax_t capactiy, typename = details::ContainerItems<Array<Type, capactiy>> >
+void sort(Array<Type, capactiy> & array)
+{
+	sort(array, stdlib::less<Type>());
+}
+
+//
+// Searching
+//
+
+// O(log N)
+// The index of the first item that does not compare before item, or getCount() if there is none
+template< typename Container, typename Compare, typename = details::ConstContainerItems<Container> >
+typename Container::IndexType lowerBound(const Container & container, const typename Container::ValueType & item, Compare compare)
+{
+	using ValueType = typename Container::ValueType;
+	using IndexType = typename Container::IndexType;
+
+	const ValueType * const data = container.getData();
+	return static_cast<IndexType>(stdlib::lower_bound(data, data + container.getCount(), item, compare) - data);
+}
+
+// O(log N)
+template< typename Container, typename = details::ConstContainerItems<Container> >
+typename Container::IndexType lowerBound(const Container & container, const typename Container::ValueType & item)
+{
+	return lowerBound(container, item, stdlib::less<typename Container::ValueType>());
+}
+
+// O(log N)
+// The index of the first item that compares after item, or getCount() if there is none
+template< typename Container, typename Compare, typename = details::ConstContainerItems<Container> >
+typename Container::IndexType upperBound(const Container & container, const typename Container::ValueType & item, Compare compare)
+{
+	using ValueType = typename Container::ValueType;
+	using IndexType = typename Container::IndexType;
+
+	const ValueType * const data = container.getData();
+	return static_cast<IndexType>(stdlib::upper_bound(data, data + container.getCount(), item, compare) - data);
+}
+
+// O(log N)
+template< typename Container, typename = details::ConstContainerItems<Container> >
+typename Container::IndexType upperBound(const Container & container, const typename Container::ValueType & item)
+{
+	return upperBound(container, item, stdlib::less<typename Container::ValueType>());
+}
+
+// O(log N)
+// The index of an item equivalent to item, or InvalidIndex if there is none
+template< typename Container, typename Compare, typename = details::ConstContainerItems<Container> >
+typename Container::IndexOfType binarySearch(const Container & container, const typename Container::ValueType & item, Compare compare)
+{
+	using ValueType = typename Container::ValueType;
+	using IndexOfType = typename Container::IndexOfType;
+
+	const ValueType * const data = container.getData();
+	const ValueType * const last = (data + container.getCount());
+	const ValueType * const result = stdlib::lower_bound(data, last, item, compare);
+
+	return ((result != last) && !compare(item, *result)) ? static_cast<IndexOfType>(result - data) : Container::InvalidIndex;
+}
+
+// O(log N)
+template< typename Container, typename = details::ConstContainerItems<Container> >
+typename Container::IndexOfType binarySearch(const Container & container, const typename Container::ValueType & item)
+{
+	return binarySearch(container, item, stdlib::less<typename Container::ValueType>());
+}
+
+//
+// Reordering
+//
+
+// O(N)
+// Not stable, returns the index of the first item that doesn't satisfy predicate
+template< typename Container, typename Predicate, typename = details::ContainerItems<Container> >
+typename Container::IndexType partition(Container & container, Predicate predicate)
+{
+	using ValueType = typename Container::ValueType;
+	using IndexType = typename Container::IndexType;
+
+	ValueType * const data = container.getData();
+	return static_cast<IndexType>(stdlib::partition(data, data + container.getCount(), predicate) - data);
+}
+
+// O(N)
+template< typename Container, typename = details::ContainerItems<Container> >
+void reverse(Container & container)
+{
+	using ValueType = typename Container::ValueType;
+
+	ValueType * const data = container.getData();
+	stdlib::reverse(data, data + container.getCount());
+}
+
+// O(N)
+// Rotates the items left by index, so the item at index becomes the first
+// and the items before it move to the end, each run keeping its order.
+// Does nothing if index is past the end.
+template< typename Container, typename = details::ContainerItems<Container> >
+void rotate(Container & container, typename Container::IndexType index)
+{
+	using ValueType = typename Container::ValueType;
+
+	if (index >= container.getCount())
+		return;
+
+	ValueType * const data = container.getData();
+	stdlib::rotate(data, data + index, data + container.getCount());
+}
\ No newline at end of file
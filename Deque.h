@@ -16,18 +16,22 @@
 //  limitations under the License.
 //
 
+#include <stddef.h>
 #include <stdint.h>
 
-#include "TypeTraits.h"
+#include "Utility.h"
+#include "Algorithm.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
 
 //
 // Declarations
 //
 
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 class Deque;
 
-template< typename Type, uint8_t capactiyValue >
+template< typename Type, uintmax_t capactiyValue >
 class Deque
 {
 public:
@@ -37,16 +41,17 @@ public:
 	//
 
 	static_assert(capactiyValue > 0, "Attempt to create Deque with a capacity less than 1");
-	static_assert(capactiyValue < 128, "Attempt to create Deque with a capacity greater than 127");
 
 	//
 	// Type Aliases
 	//
 
 	using ValueType = Type;
-	using SizeType = uint8_t;
-	using IndexType = uint8_t;
-	using IndexOfType = int8_t;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
 	
 	//
 	// Constants
@@ -63,9 +68,35 @@ private:
 	// Member Variables
 	//
 	
-	ValueType items[capactiy] = {};
+	UninitialisedStorage<ValueType, capactiy> items;
 	IndexType next = 0;
 	
+public:
+
+	//
+	// Constructors, Destructor and Assignment
+	//
+
+	Deque() = default;
+
+	// O(N)
+	Deque(const Deque & other);
+
+	// O(N)
+	Deque(Deque && other);
+
+	// O(N)
+	~Deque()
+	{
+		this->clear();
+	}
+
+	// O(N)
+	Deque & operator =(const Deque & other);
+
+	// O(N)
+	Deque & operator =(Deque && other);
+
 public:
 
 	//
@@ -99,13 +130,13 @@ public:
 	// O(1)
 	ValueType * getData() noexcept
 	{
-		return &this->items[FirstIndex];
+		return this->items.getData();
 	}
 	
 	// O(1)
 	const ValueType * getData() const noexcept
 	{
-		return &this->items[FirstIndex];
+		return this->items.getData();
 	}
 	
 	// O(1)
@@ -119,6 +150,30 @@ public:
 	{
 		return this->items[index];
 	}
+
+	// O(1)
+	Iterator begin() noexcept
+	{
+		return this->items.getData();
+	}
+
+	// O(1)
+	ConstIterator begin() const noexcept
+	{
+		return this->items.getData();
+	}
+
+	// O(1)
+	Iterator end() noexcept
+	{
+		return this->items.getData() + this->next;
+	}
+
+	// O(1)
+	ConstIterator end() const noexcept
+	{
+		return this->items.getData() + this->next;
+	}
 	
 	// O(N)
 	void clear();
@@ -134,6 +189,13 @@ public:
 	
 	// O(N)
 	IndexOfType indexOfLast(const ValueType & item) const;
+
+	// O(N)
+	SizeType count(const ValueType & item) const;
+
+	// O(N)
+	// Returns the index of the first item that equals any of the count items in set
+	IndexOfType indexOfAny(const ValueType * set, size_t count) const;
 	
 public:
 
@@ -156,26 +218,86 @@ public:
 	// O(1)
 	ValueType & getLast()
 	{
-		return this->items[this->next];
+		return this->items[this->next - 1];
 	}
 
 	// O(1)
 	const ValueType & getLast() const
 	{
-		return this->items[this->next];
+		return this->items[this->next - 1];
 	}
 
 	// O(1)
-	bool append(const ValueType & item);
+	bool append(const ValueType & item)
+	{
+		return this->emplaceBack(item);
+	}
 
 	// O(1)
-	bool prepend(const ValueType & item);
+	bool append(ValueType && item)
+	{
+		return this->emplaceBack(stdlib::move(item));
+	}
 
 	// O(1)
-	void unappend();
+	template< typename ... Arguments >
+	bool emplaceBack(Arguments && ... arguments);
+
+	// O(N)
+	bool prepend(const ValueType & item)
+	{
+		return this->emplaceFront(item);
+	}
+
+	// O(N)
+	bool prepend(ValueType && item)
+	{
+		return this->emplaceFront(stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceFront(Arguments && ... arguments);
 
 	// O(1)
+	void unappend();
+
+	// O(N)
 	void unprepend();
+
+	// O(N)
+	// Appends as many items as will fit, returns the number appended
+	SizeType appendRange(const ValueType * source, SizeType count);
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType appendRange(const OtherContainer & container)
+	{
+		const auto count = container.getCount();
+		return this->appendRange(container.getData(), (count < capactiy) ? static_cast<SizeType>(count) : capactiy);
+	}
+
+	// O(N)
+	// Prepends as many items as will fit, keeping their order, returns the number prepended
+	SizeType prependRange(const ValueType * source, SizeType count);
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType prependRange(const OtherContainer & container)
+	{
+		const auto count = container.getCount();
+		return this->prependRange(container.getData(), (count < capactiy) ? static_cast<SizeType>(count) : capactiy);
+	}
+
+	// O(N)
+	// Moves up to count items from the end into destination, keeping their order,
+	// returns the number moved
+	SizeType unappendInto(ValueType * destination, SizeType count);
+
+	// O(N)
+	// Moves up to count items from the start into destination, keeping their order,
+	// returns the number moved
+	SizeType unprependInto(ValueType * destination, SizeType count);
 	
 	// O(N)
 	bool removeFirst(const ValueType & item);
@@ -187,7 +309,34 @@ public:
 	bool removeAt(IndexType index);
 
 	// O(N)
-	bool insert(IndexType index, const ValueType & item);
+	// Like removeFirst, but fills the gap with the last item instead of shifting the rest
+	bool removeFirstUnordered(const ValueType & item);
+
+	// O(1)
+	// Like removeAt, but fills the gap with the last item instead of shifting the rest
+	bool removeAtUnordered(IndexType index);
+
+	// O(N)
+	// Removes every item that satisfies predicate in a single pass, keeping the order of the rest.
+	// Returns the number removed.
+	template< typename Predicate >
+	SizeType removeIf(Predicate predicate);
+
+	// O(N)
+	bool insert(IndexType index, const ValueType & item)
+	{
+		return this->emplaceAt(index, item);
+	}
+
+	// O(N)
+	bool insert(IndexType index, ValueType && item)
+	{
+		return this->emplaceAt(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceAt(IndexType index, Arguments && ... arguments);
 };
 
 //
@@ -195,173 +344,350 @@ public:
 //
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
+Deque<Type, capactiy>::Deque(const Deque & other)
+{
+	for (IndexType i = 0; i < other.next; ++i)
+		this->items.construct(i, other.items[i]);
+
+	this->next = other.next;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+Deque<Type, capactiy>::Deque(Deque && other)
+{
+	for (IndexType i = 0; i < other.next; ++i)
+		this->items.construct(i, stdlib::move(other.items[i]));
+
+	this->next = other.next;
+	other.clear();
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::operator =(const Deque & other) -> Deque &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType i = 0; i < other.next; ++i)
+			this->items.construct(i, other.items[i]);
+
+		this->next = other.next;
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::operator =(Deque && other) -> Deque &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType i = 0; i < other.next; ++i)
+			this->items.construct(i, stdlib::move(other.items[i]));
+
+		this->next = other.next;
+		other.clear();
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
 void Deque<Type, capactiy>::clear()
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		this->items[i].~ValueType();
+	ValueType * const data = this->getData();
+	stdlib::destroy(data, data + this->next);
+
 	this->next = 0;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 void Deque<Type, capactiy>::fill(const ValueType & item)
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		this->items[i] = item;
+	ValueType * const data = this->getData();
+	stdlib::fill(data, data + this->next, item);
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 bool Deque<Type, capactiy>::contains(const ValueType & item) const
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		if (this->items[i] == item)
-			return true;
-
-	return false;
+	return (this->indexOfFirst(item) != InvalidIndex);
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 auto Deque<Type, capactiy>::indexOfFirst(const ValueType & item) const -> IndexOfType
 {
-	for (IndexType i = 0; i < this->getCount(); ++i)
-		if (this->items[i] == item)
-			return i;
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find(data, data + this->next, item);
 
-	return InvalidIndex;
+	return (result != (data + this->next)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 auto Deque<Type, capactiy>::indexOfLast(const ValueType & item) const -> IndexOfType
 {
-	for (IndexType i = this->getCount() - 1; i > 0; --i)
-		if (this->items[i] == item)
-			return i;
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find_last(data, data + this->next, item);
 
-	return InvalidIndex;
+	return (result != (data + this->next)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
-// O(1)
-template< typename Type, uint8_t capactiy >
-bool Deque<Type, capactiy>::append(const ValueType & item)
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::count(const ValueType & item) const -> SizeType
 {
-	if (this->isFull())
-		return false;
+	const ValueType * const data = this->getData();
+	return static_cast<SizeType>(stdlib::count(data, data + this->next, item));
+}
 
-	this->items[this->next] = item;
-	++this->next;
-	return true;
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::indexOfAny(const ValueType * set, size_t count) const -> IndexOfType
+{
+	const ValueType * const data = this->getData();
+	const ValueType * const result = stdlib::find_first_of(data, data + this->next, set, set + count);
+
+	return (result != (data + this->next)) ? static_cast<IndexOfType>(result - data) : InvalidIndex;
 }
 
 // O(1)
-template< typename Type, uint8_t capactiy >
-bool Deque<Type, capactiy>::prepend(const ValueType & item)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool Deque<Type, capactiy>::emplaceBack(Arguments && ... arguments)
 {
 	if (this->isFull())
 		return false;
 
+	this->items.construct(this->next, stdlib::forward<Arguments>(arguments)...);
 	++this->next;
-	for (IndexType i = this->next; i > 0; --i)
-			this->items[i] = stdlib::move(this->items[i - 1]);
-
-	this->items[0] = item;
 	return true;
 }
 
+// O(N)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool Deque<Type, capactiy>::emplaceFront(Arguments && ... arguments)
+{
+	return this->emplaceAt(FirstIndex, stdlib::forward<Arguments>(arguments)...);
+}
+
 // O(1)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 void Deque<Type, capactiy>::unappend()
 {
 	if (this->isEmpty())
 		return;
 
 	--this->next;
-	this->items[this->next].~ValueType();
-	return true;
+	this->items.destroy(this->next);
 }
 
-// O(1)
-template< typename Type, uint8_t capactiy >
+// O(N)
+template< typename Type, uintmax_t capactiy >
 void Deque<Type, capactiy>::unprepend()
 {
-	if (this->isEmpty())
-		return;
+	this->removeAt(FirstIndex);
+}
 
-	--this->next;
-	for (IndexType i = 0; i < this->next; ++i)
-			this->items[i] = stdlib::move(this->items[i + 1]);
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::appendRange(const ValueType * source, SizeType count) -> SizeType
+{
+	const SizeType space = (capactiy - this->next);
+	const SizeType amount = (count < space) ? count : space;
 
-	this->items[this->next].~ValueType();
-	return true;
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->getData();
+	stdlib::uninitialized_copy(source, source + amount, data + this->next);
+
+	this->next += amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::prependRange(const ValueType * source, SizeType count) -> SizeType
+{
+	const SizeType space = (capactiy - this->next);
+	const SizeType amount = (count < space) ? count : space;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->getData();
+
+	// Existing items that end up past the current end go into empty slots,
+	// the rest are moved over the live items in front of them
+	const SizeType overflow = (amount < this->next) ? amount : this->next;
+	stdlib::uninitialized_move(data + (this->next - overflow), data + this->next, data + (this->next - overflow) + amount);
+	stdlib::move_backward(data, data + (this->next - overflow), data + (this->next - overflow) + amount);
+
+	// Likewise the new items overwrite moved-from items where there are any
+	stdlib::copy(source, source + overflow, data);
+	stdlib::uninitialized_copy(source + overflow, source + amount, data + overflow);
+
+	this->next += amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::unappendInto(ValueType * destination, SizeType count) -> SizeType
+{
+	const SizeType amount = (count < this->next) ? count : this->next;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->getData();
+	ValueType * const first = (data + (this->next - amount));
+
+	stdlib::move(first, data + this->next, destination);
+	stdlib::destroy(first, data + this->next);
+
+	this->next -= amount;
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+auto Deque<Type, capactiy>::unprependInto(ValueType * destination, SizeType count) -> SizeType
+{
+	const SizeType amount = (count < this->next) ? count : this->next;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->getData();
+
+	stdlib::move(data, data + amount, destination);
+	stdlib::move(data + amount, data + this->next, data);
+	stdlib::destroy(data + (this->next - amount), data + this->next);
+
+	this->next -= amount;
+	return amount;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 bool Deque<Type, capactiy>::removeFirst(const ValueType & item)
 {
-	for(IndexType i = 0; i < this->next; ++i)
-		if (this->items[i] == item)
-		{
-			--this->next;
-			for (IndexType j = i; j < this->next; ++j)
-				this->items[j] = stdlib::move(this->items[j + 1]);
-
-			this->items[this->next].~ValueType();
-			return true;
-		}
-	return false;
+	const IndexOfType index = this->indexOfFirst(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAt(static_cast<IndexType>(index));
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 bool Deque<Type, capactiy>::removeLast(const ValueType & item)
 {
-	for(IndexType i = this->next - 1; i > 0; --i)
-		if (this->items[i] == item)
-		{
-			--this->next;
-			for (IndexType j = i; j < this->next; ++j)
-				this->items[j] = stdlib::move(this->items[j + 1]);
-
-			this->items[this->next].~ValueType();
-			return true;
-		}
-	return false;
+	const IndexOfType index = this->indexOfLast(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAt(static_cast<IndexType>(index));
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
+template< typename Type, uintmax_t capactiy >
 bool Deque<Type, capactiy>::removeAt(IndexType index)
 {
 	if(index >= this->next)
 		return false;
 
-	--this->next;
-	for (IndexType i = index; i < this->next; ++i)
-			this->items[i] = stdlib::move(this->items[i + 1]);
+	ValueType * const data = this->getData();
+	stdlib::move(data + index + 1, data + this->next, data + index);
 
-	this->items[this->next].~ValueType();
+	--this->next;
+	this->items.destroy(this->next);
 	return true;
 }
 
 // O(N)
-template< typename Type, uint8_t capactiy >
-bool Deque<Type, capactiy>::insert(IndexType index, const ValueType & item)
+template< typename Type, uintmax_t capactiy >
+bool Deque<Type, capactiy>::removeFirstUnordered(const ValueType & item)
+{
+	const IndexOfType index = this->indexOfFirst(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAtUnordered(static_cast<IndexType>(index));
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+bool Deque<Type, capactiy>::removeAtUnordered(IndexType index)
 {
 	if(index >= this->next)
 		return false;
 
+	--this->next;
+
+	if (index != this->next)
+		this->items[index] = stdlib::move(this->items[this->next]);
+
+	this->items.destroy(this->next);
+	return true;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+template< typename Predicate >
+auto Deque<Type, capactiy>::removeIf(Predicate predicate) -> SizeType
+{
+	ValueType * const data = this->getData();
+	ValueType * const end = (data + this->next);
+	ValueType * const kept = stdlib::remove_if(data, end, predicate);
+
+	stdlib::destroy(kept, end);
+
+	const SizeType removed = static_cast<SizeType>(end - kept);
+	this->next -= removed;
+	return removed;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool Deque<Type, capactiy>::emplaceAt(IndexType index, Arguments && ... arguments)
+{
+	if(index > this->next)
+		return false;
+
 	if (this->isFull())
 		return false;
 
-	++this->next;
-	for (IndexType i = index + 1; i < this->next; ++i)
-		this->items[i] = stdlib::move(this->items[i + 1]);
+	if (index == this->next)
+		return this->emplaceBack(stdlib::forward<Arguments>(arguments)...);
 
-	this->items[index] = item;
+	// Build the item before shifting in case the arguments refer to an item
+	ValueType item(stdlib::forward<Arguments>(arguments)...);
+
+	// The slot past the end has no object in it yet
+	this->items.construct(this->next, stdlib::move(this->items[this->next - 1]));
+
+	ValueType * const data = this->getData();
+	stdlib::move_backward(data + index, data + this->next - 1, data + this->next);
+
+	this->items[index] = stdlib::move(item);
+	++this->next;
 	return true;
 }
 
@@ -382,6 +708,8 @@ public:
 	using SizeType = uint8_t;
 	using IndexType = uint8_t;
 	using IndexOfType = int8_t;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
 	
 	//
 	// Constants
@@ -439,6 +767,30 @@ public:
 	
 	// O(1)
 	constexpr const ValueType & operator [](IndexType index) const = delete;
+
+	// O(1)
+	/*constexpr*/ Iterator begin() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator begin() const noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	/*constexpr*/ Iterator end() noexcept
+	{
+		return nullptr;
+	}
+
+	// O(1)
+	constexpr ConstIterator end() const noexcept
+	{
+		return nullptr;
+	}
 	
 	// O(1)
 	constexpr void clear() noexcept
@@ -452,7 +804,25 @@ public:
 	}
 	
 	// O(1)
-	constexpr IndexOfType indexOf(const ValueType & item) const noexcept
+	constexpr IndexOfType indexOfFirst(const ValueType & item) const noexcept
+	{
+		return InvalidIndex;
+	}
+	
+	// O(1)
+	constexpr IndexOfType indexOfLast(const ValueType & item) const noexcept
+	{
+		return InvalidIndex;
+	}
+	
+	// O(1)
+	constexpr SizeType count(const ValueType & item) const noexcept
+	{
+		return 0;
+	}
+	
+	// O(1)
+	constexpr IndexOfType indexOfAny(const ValueType * set, size_t count) const noexcept
 	{
 		return InvalidIndex;
 	}
@@ -481,12 +851,26 @@ public:
 		return false;
 	}
 
+	// O(1)
+	template< typename ... Arguments >
+	constexpr bool emplaceBack(Arguments && ... arguments)
+	{
+		return false;
+	}
+
 	// O(1)
 	constexpr bool prepend(const ValueType & item)
 	{
 		return false;
 	}
 
+	// O(1)
+	template< typename ... Arguments >
+	constexpr bool emplaceFront(Arguments && ... arguments)
+	{
+		return false;
+	}
+
 	// O(1)
 	constexpr void unappend()
 	{
@@ -496,6 +880,44 @@ public:
 	constexpr void unprepend()
 	{
 	}
+
+	// O(1)
+	constexpr SizeType appendRange(const ValueType * source, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	template< typename OtherContainer >
+	constexpr SizeType appendRange(const OtherContainer & container)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType prependRange(const ValueType * source, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	template< typename OtherContainer >
+	constexpr SizeType prependRange(const OtherContainer & container)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType unappendInto(ValueType * destination, SizeType count)
+	{
+		return 0;
+	}
+
+	// O(1)
+	constexpr SizeType unprependInto(ValueType * destination, SizeType count)
+	{
+		return 0;
+	}
 	
 	// O(N)
 	constexpr bool removeFirst(const ValueType & item)
@@ -515,9 +937,35 @@ public:
 		return false;
 	}
 
+	// O(N)
+	constexpr bool removeFirstUnordered(const ValueType & item)
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr bool removeAtUnordered(IndexType index)
+	{
+		return false;
+	}
+
+	// O(N)
+	template< typename Predicate >
+	constexpr SizeType removeIf(Predicate predicate)
+	{
+		return 0;
+	}
+
 	// O(N)
 	constexpr bool insert(IndexType index, const ValueType & item)
 	{
 		return false;
 	}
+
+	// O(N)
+	template< typename ... Arguments >
+	constexpr bool emplaceAt(IndexType index, Arguments && ... arguments)
+	{
+		return false;
+	}
 };
\ No newline at end of file
@@ -0,0 +1,451 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "IntegerTypes.h"
+#include "Utility.h"
+#include "Algorithm.h"
+#include "Functional.h"
+#include "Span.h"
+
+//
+// Declarations
+//
+
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare = stdlib::less<Key> >
+class FlatMap;
+
+// Maps up to capactiy keys to values, keeping the keys in order in one array
+// and the values in the same order in another.
+// Lookups are binary searches that only touch the keys,
+// so they read as little memory as possible, which suits small read mostly tables.
+// To fill a table, addUnsorted every entry and then sort once,
+// which is far cheaper than keeping the order as each entry is added.
+template< typename Key, typename Value, uintmax_t capactiyValue, typename Compare >
+class FlatMap
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create FlatMap with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using KeyType = Key;
+	using ValueType = Value;
+	using CompareType = Compare;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	// Plain arrays rather than Array, which packs bool into bits,
+	// so that a bool key or value can still be referenced and searched
+	KeyType keys[capactiy] = {};
+	ValueType values[capactiy] = {};
+	SizeType count = 0;
+
+	//
+	// IndexCompare
+	//
+
+	// Orders entry indices by their keys,
+	// and indices with equivalent keys by the order they were added in
+	class IndexCompare
+	{
+	private:
+		const KeyType * keys;
+
+	public:
+		IndexCompare(const KeyType * keys) noexcept
+			: keys(keys)
+		{
+		}
+
+		bool operator ()(IndexType left, IndexType right) const
+		{
+			if (CompareType()(this->keys[left], this->keys[right]))
+				return true;
+
+			if (CompareType()(this->keys[right], this->keys[left]))
+				return false;
+
+			return (left < right);
+		}
+	};
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	static bool isEquivalent(const KeyType & left, const KeyType & right)
+	{
+		return !CompareType()(left, right) && !CompareType()(right, left);
+	}
+
+	// O(1)
+	void swapEntries(IndexType left, IndexType right)
+	{
+		stdlib::swap(this->keys[left], this->keys[right]);
+		stdlib::swap(this->values[left], this->values[right]);
+	}
+
+	// O(N)
+	// Moves each entry to where order says it goes,
+	// where order[index] is the index of the entry that belongs at index
+	void applyOrder(IndexType * order);
+
+	// O(N)
+	void removeDuplicates();
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return (this->count == 0);
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return (this->count == capactiy);
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->count;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	// Forgets every entry. The keys and values are overwritten as new entries are added.
+	void clear() noexcept
+	{
+		this->count = 0;
+	}
+
+	// O(log N)
+	bool contains(const KeyType & key) const
+	{
+		return (this->indexOf(key) != InvalidIndex);
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	// The keys in order
+	Span<const KeyType> getKeys() const noexcept
+	{
+		return Span<const KeyType>(&this->keys[0], this->count);
+	}
+
+	// O(1)
+	// The values, in the same order as their keys
+	Span<ValueType> getValues() noexcept
+	{
+		return Span<ValueType>(&this->values[0], this->count);
+	}
+
+	// O(1)
+	Span<const ValueType> getValues() const noexcept
+	{
+		return Span<const ValueType>(&this->values[0], this->count);
+	}
+
+	// O(1)
+	const KeyType & getKeyAt(IndexType index) const
+	{
+		return this->keys[index];
+	}
+
+	// O(1)
+	ValueType & getValueAt(IndexType index)
+	{
+		return this->values[index];
+	}
+
+	// O(1)
+	const ValueType & getValueAt(IndexType index) const
+	{
+		return this->values[index];
+	}
+
+	// O(log N)
+	// The index of the first key that does not compare before key, or getCount() if there is none
+	IndexType lowerBound(const KeyType & key) const;
+
+	// O(log N)
+	// The index of key, or InvalidIndex if there is none
+	IndexOfType indexOf(const KeyType & key) const;
+
+	// O(log N)
+	// The value for key, or nullptr if there is none
+	ValueType * find(const KeyType & key)
+	{
+		const IndexOfType index = this->indexOf(key);
+		return (index != InvalidIndex) ? &this->values[static_cast<IndexType>(index)] : nullptr;
+	}
+
+	// O(log N)
+	const ValueType * find(const KeyType & key) const
+	{
+		const IndexOfType index = this->indexOf(key);
+		return (index != InvalidIndex) ? &this->values[static_cast<IndexType>(index)] : nullptr;
+	}
+
+	// O(N)
+	// Does nothing if key is already present.
+	// Returns false if nothing was added, because key was present or the map is full.
+	bool add(const KeyType & key, const ValueType & value);
+
+	// O(N)
+	// Adds key or replaces its value, returns false only if key was missing and the map is full
+	bool set(const KeyType & key, const ValueType & value);
+
+	// O(1)
+	// Adds an entry to the end without keeping the order,
+	// sort must be called before the next lookup or ordered add
+	bool addUnsorted(const KeyType & key, const ValueType & value);
+
+	// O(N log N)
+	// Puts the entries back in order after addUnsorted.
+	// If a key was added more than once, the value added last is kept.
+	// Uses one IndexType per entry of stack.
+	void sort();
+
+	// O(N)
+	bool remove(const KeyType & key);
+
+	// O(N)
+	bool removeAt(IndexType index);
+};
+
+//
+// Definition
+//
+
+// O(N)
+// Follows each cycle of the permutation once, so every entry is moved exactly once
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+void FlatMap<Key, Value, capactiy, Compare>::applyOrder(IndexType * order)
+{
+	for (IndexType start = 0; start < this->count; ++start)
+	{
+		if (order[start] == start)
+			continue;
+
+		KeyType key = stdlib::move(this->keys[start]);
+		ValueType value = stdlib::move(this->values[start]);
+		IndexType hole = start;
+
+		for (;;)
+		{
+			const IndexType source = order[hole];
+			order[hole] = hole;
+
+			if (source == start)
+				break;
+
+			this->keys[hole] = stdlib::move(this->keys[source]);
+			this->values[hole] = stdlib::move(this->values[source]);
+			hole = source;
+		}
+
+		this->keys[hole] = stdlib::move(key);
+		this->values[hole] = stdlib::move(value);
+	}
+}
+
+// O(N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+void FlatMap<Key, Value, capactiy, Compare>::removeDuplicates()
+{
+	if (this->count < 2)
+		return;
+
+	IndexType last = 0;
+
+	for (IndexType index = 1; index < this->count; ++index)
+	{
+		// Equivalent keys are in the order they were added, so a later entry replaces an earlier one
+		if (isEquivalent(this->keys[last], this->keys[index]))
+		{
+			this->keys[last] = stdlib::move(this->keys[index]);
+			this->values[last] = stdlib::move(this->values[index]);
+			continue;
+		}
+
+		++last;
+
+		if (last != index)
+		{
+			this->keys[last] = stdlib::move(this->keys[index]);
+			this->values[last] = stdlib::move(this->values[index]);
+		}
+	}
+
+	this->count = (last + 1);
+}
+
+// O(log N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+auto FlatMap<Key, Value, capactiy, Compare>::lowerBound(const KeyType & key) const -> IndexType
+{
+	const KeyType * const data = &this->keys[0];
+	return static_cast<IndexType>(stdlib::lower_bound(data, data + this->count, key, CompareType()) - data);
+}
+
+// O(log N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+auto FlatMap<Key, Value, capactiy, Compare>::indexOf(const KeyType & key) const -> IndexOfType
+{
+	const IndexType index = this->lowerBound(key);
+
+	if ((index < this->count) && !CompareType()(key, this->keys[index]))
+		return static_cast<IndexOfType>(index);
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+bool FlatMap<Key, Value, capactiy, Compare>::add(const KeyType & key, const ValueType & value)
+{
+	const IndexType index = this->lowerBound(key);
+
+	if ((index < this->count) && !CompareType()(key, this->keys[index]))
+		return false;
+
+	if (this->isFull())
+		return false;
+
+	KeyType * const keyData = &this->keys[0];
+	ValueType * const valueData = &this->values[0];
+
+	stdlib::move_backward(keyData + index, keyData + this->count, keyData + this->count + 1);
+	stdlib::move_backward(valueData + index, valueData + this->count, valueData + this->count + 1);
+
+	this->keys[index] = key;
+	this->values[index] = value;
+	++this->count;
+	return true;
+}
+
+// O(N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+bool FlatMap<Key, Value, capactiy, Compare>::set(const KeyType & key, const ValueType & value)
+{
+	const IndexOfType index = this->indexOf(key);
+
+	if (index == InvalidIndex)
+		return this->add(key, value);
+
+	this->values[static_cast<IndexType>(index)] = value;
+	return true;
+}
+
+// O(1)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+bool FlatMap<Key, Value, capactiy, Compare>::addUnsorted(const KeyType & key, const ValueType & value)
+{
+	if (this->isFull())
+		return false;
+
+	this->keys[this->count] = key;
+	this->values[this->count] = value;
+	++this->count;
+	return true;
+}
+
+// O(N log N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+void FlatMap<Key, Value, capactiy, Compare>::sort()
+{
+	IndexType order[capactiy];
+
+	for (IndexType index = 0; index < this->count; ++index)
+		order[index] = index;
+
+	stdlib::sort(&order[0], &order[0] + this->count, IndexCompare(&this->keys[0]));
+	this->applyOrder(order);
+
+	this->removeDuplicates();
+}
+
+// O(N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+bool FlatMap<Key, Value, capactiy, Compare>::remove(const KeyType & key)
+{
+	const IndexOfType index = this->indexOf(key);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->removeAt(static_cast<IndexType>(index));
+}
+
+// O(N)
+template< typename Key, typename Value, uintmax_t capactiy, typename Compare >
+bool FlatMap<Key, Value, capactiy, Compare>::removeAt(IndexType index)
+{
+	if (index >= this->count)
+		return false;
+
+	KeyType * const keyData = &this->keys[0];
+	ValueType * const valueData = &this->values[0];
+
+	stdlib::move(keyData + index + 1, keyData + this->count, keyData + index);
+	stdlib::move(valueData + index + 1, valueData + this->count, valueData + index);
+
+	--this->count;
+	return true;
+}
\ No newline at end of file
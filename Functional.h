@@ -0,0 +1,174 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(USE_NAMESPACE_STD)
+namespace stdlib
+{
+}
+
+namespace std
+{
+	using namespace stdlib;
+}
+#endif
+
+namespace stdlib
+{
+
+	//
+	//
+	// Declarations
+	//
+	//
+
+	template< typename Type >
+	struct less;
+
+	template< typename Type >
+	struct greater;
+
+	template< typename Type >
+	struct equal_to;
+
+	template< typename Type >
+	struct hash;
+
+	//
+	//
+	// Definitions
+	//
+	//
+
+	template< typename Type >
+	struct less
+	{
+		constexpr bool operator ()(const Type & left, const Type & right) const
+		{
+			return (left < right);
+		}
+	};
+
+	template< typename Type >
+	struct greater
+	{
+		constexpr bool operator ()(const Type & left, const Type & right) const
+		{
+			return (right < left);
+		}
+	};
+
+	template< typename Type >
+	struct equal_to
+	{
+		constexpr bool operator ()(const Type & left, const Type & right) const
+		{
+			return (left == right);
+		}
+	};
+
+	namespace details
+	{
+		// Integers hash to themselves, so hash tables must spread the bits themselves.
+		// Integers wider than size_t (such as uint32_t on AVR) are folded down
+		// so that no bits are thrown away.
+		template< typename Type, bool isWide = (sizeof(Type) > sizeof(size_t)) >
+		struct IntegerHash
+		{
+			constexpr size_t operator ()(Type value) const noexcept
+			{
+				return static_cast<size_t>(value);
+			}
+		};
+
+		template< typename Type >
+		struct IntegerHash<Type, true>
+		{
+			size_t operator ()(Type value) const noexcept
+			{
+				uintmax_t bits = static_cast<uintmax_t>(value);
+				size_t result = 0;
+
+				for (size_t index = 0; index < sizeof(Type); index += sizeof(size_t))
+				{
+					result ^= static_cast<size_t>(bits);
+					bits >>= (sizeof(size_t) * 8);
+				}
+
+				return result;
+			}
+		};
+	}
+
+	template<>
+	struct hash<bool> : details::IntegerHash<bool> {};
+
+	template<>
+	struct hash<char> : details::IntegerHash<char> {};
+
+	template<>
+	struct hash<signed char> : details::IntegerHash<signed char> {};
+
+	template<>
+	struct hash<unsigned char> : details::IntegerHash<unsigned char> {};
+
+	template<>
+	struct hash<char16_t> : details::IntegerHash<char16_t> {};
+
+	template<>
+	struct hash<char32_t> : details::IntegerHash<char32_t> {};
+
+	template<>
+	struct hash<wchar_t> : details::IntegerHash<wchar_t> {};
+
+	template<>
+	struct hash<signed short> : details::IntegerHash<signed short> {};
+
+	template<>
+	struct hash<unsigned short> : details::IntegerHash<unsigned short> {};
+
+	template<>
+	struct hash<signed int> : details::IntegerHash<signed int> {};
+
+	template<>
+	struct hash<unsigned int> : details::IntegerHash<unsigned int> {};
+
+	template<>
+	struct hash<signed long int> : details::IntegerHash<signed long int> {};
+
+	template<>
+	struct hash<unsigned long int> : details::IntegerHash<unsigned long int> {};
+
+	template<>
+	struct hash<signed long long int> : details::IntegerHash<signed long long int> {};
+
+	template<>
+	struct hash<unsigned long long int> : details::IntegerHash<unsigned long long int> {};
+
+	template< typename Type >
+	struct hash<Type *>
+	{
+		size_t operator ()(Type * value) const noexcept
+		{
+			return details::IntegerHash<uintptr_t>()(reinterpret_cast<uintptr_t>(value));
+		}
+	};
+
+}
\ No newline at end of file
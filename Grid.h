@@ -18,24 +18,31 @@
 
 #include <stdint.h>
 
-template< typename Type, uint8_t Width, uint8_t Height >
+#include "IntegerTypes.h"
+#include "Algorithm.h"
+#include "BitStorage.h"
+#include "Span.h"
+#include "StridedSpan.h"
+#include "GridRegion.h"
+#include "GridLayout.h"
+
+template< typename Type, uintmax_t Width, uintmax_t Height, typename Layout = RowMajorLayout >
 class Grid;
 
-template< typename Type, uint8_t WidthValue, uint8_t HeightValue >
+// Layout decides how the cells are arranged in memory, see GridLayout.h.
+// Rows, columns and regions are only available with the default RowMajorLayout,
+// because only that layout keeps each row contiguous.
+template< typename Type, uintmax_t WidthValue, uintmax_t HeightValue, typename Layout >
 class Grid
 {
 private:
 
 	//
-	// Private Helper Types (Ignore These)
+	// Private Type Aliases
 	//
 
-	template< bool Condition, typename T, typename U > struct ContitionalHelper;
-	template< typename T, typename U > struct ContitionalHelper<true, T, U> { using RType = T; };
-	template< typename T, typename U > struct ContitionalHelper<false, T, U> { using RType = U; };
-	template< bool Condition, typename T, typename U > using ConditionalType = typename ContitionalHelper<Condition, T, U>::RType;
-	constexpr static const uint16_t SecretCapacity = static_cast<uint16_t>(WidthValue) * static_cast<uint16_t>(HeightValue);
-	
+	using MappingType = typename Layout::template Mapping<WidthValue, HeightValue>;
+
 public:
 
 	//
@@ -43,9 +50,12 @@ public:
 	//
 	
 	using ValueType = Type;
-	using SizeType = ConditionalType<(SecretCapacity > 256), uint16_t, uint8_t>;
-	using IndexType = SizeType;
-	using DimensionType = uint8_t;
+	using LayoutType = Layout;
+	using SizeType = SmallestUnsignedType<MappingType::StorageSize>;
+	using IndexType = typename MappingType::IndexType;
+	using DimensionType = SmallestUnsignedType<((WidthValue > HeightValue) ? WidthValue : HeightValue)>;
+	using Iterator = ValueType *;
+	using ConstIterator = const ValueType *;
 	
 	//
 	// Constants
@@ -53,23 +63,49 @@ public:
 	
 	constexpr static const DimensionType Width = WidthValue;
 	constexpr static const DimensionType Height = HeightValue;
-	constexpr static const SizeType Capacity = static_cast<SizeType>(Width) * static_cast<SizeType>(Height);
+
+	// The number of items stored, which includes any padding the layout adds
+	constexpr static const SizeType Capacity = MappingType::StorageSize;
 
 private:
+
+	//
+	// Private Constants
+	//
+
+	constexpr static const bool IsRowMajor = stdlib::is_same<Layout, RowMajorLayout>::value;
 	
 	//
 	// Member Variables
 	//
 	
-	ValueType items[Capacity];
+	ValueType items[Capacity] = {};
+
+public:
 
 	//
-	// Private Member Functions
+	// Constructors
 	//
 
-	inline IndexType flattenIndex(const DimensionType & x, const DimensionType & y) const
+	// O(N)
+	Grid() = default;
+
+	// O(N)
+	// Items are given row by row, any not given are value initialised
+	constexpr explicit Grid(const ValueType & item)
+		: items { item }
+	{
+		static_assert(IsRowMajor, "Only a row major Grid can be given its items row by row");
+	}
+
+	// O(N)
+	// Items are given row by row, any not given are value initialised.
+	// In a constexpr context, a value that doesn't fit ValueType fails to compile.
+	template< typename Other, typename ... Others >
+	constexpr Grid(const ValueType & item, const Other & other, const Others & ... others)
+		: items { item, details::convertItem<ValueType>(other), details::convertItem<ValueType>(others) ... }
 	{
-		return (Width * static_cast<IndexType>(y)) + static_cast<IndexType>(x);
+		static_assert(IsRowMajor, "Only a row major Grid can be given its items row by row");
 	}
 
 public:
@@ -97,22 +133,207 @@ public:
 	}
 
 	// O(1)
-	ValueType & getItem(const uint8_t & x, const uint8_t & y)
+	// Every cell always holds an item, as does any padding
+	constexpr SizeType getCount() const noexcept
+	{
+		return Capacity;
+	}
+
+	// O(1)
+	// Cell (x, y) is item getIndex(x, y), which is (y * width) + x for a row major grid
+	STDLIB_CONSTEXPR14 ValueType * getData() noexcept
+	{
+		return &this->items[0];
+	}
+
+	// O(1)
+	constexpr const ValueType * getData() const noexcept
+	{
+		return &this->items[0];
+	}
+
+	// O(1)
+	// Iterates over every item in memory order, which is row by row for a row major grid
+	STDLIB_CONSTEXPR14 Iterator begin() noexcept
+	{
+		return &this->items[0];
+	}
+
+	// O(1)
+	constexpr ConstIterator begin() const noexcept
 	{
-		return this->items[this->flattenIndex(x, y)];
+		return &this->items[0];
+	}
+
+	// O(1)
+	STDLIB_CONSTEXPR14 Iterator end() noexcept
+	{
+		return &this->items[0] + Capacity;
+	}
+
+	// O(1)
+	constexpr ConstIterator end() const noexcept
+	{
+		return &this->items[0] + Capacity;
+	}
+
+	// O(1)
+	// The Width cells of row y
+	Span<ValueType> getRow(const DimensionType & y) noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return Span<ValueType>(&this->items[getIndex(0, y)], Width);
+	}
+
+	// O(1)
+	Span<const ValueType> getRow(const DimensionType & y) const noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return Span<const ValueType>(&this->items[getIndex(0, y)], Width);
+	}
+
+	// O(1)
+	// The Height cells of column x
+	StridedSpan<ValueType> getColumn(const DimensionType & x) noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return StridedSpan<ValueType>(&this->items[x], Height, Width);
+	}
+
+	// O(1)
+	StridedSpan<const ValueType> getColumn(const DimensionType & x) const noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return StridedSpan<const ValueType>(&this->items[x], Height, Width);
+	}
+
+	// O(1)
+	// Every cell, as a region
+	GridRegion<ValueType> getRegion() noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return GridRegion<ValueType>(&this->items[0], Width, Height, Width);
+	}
+
+	// O(1)
+	GridRegion<const ValueType> getRegion() const noexcept
+	{
+		static_assert(IsRowMajor, "Only a row major Grid has rows, columns and regions");
+		return GridRegion<const ValueType>(&this->items[0], Width, Height, Width);
+	}
+
+	// O(1)
+	// Up to width by height cells with (x, y) at the top left, cut short at the edges of the grid
+	GridRegion<ValueType> getRegion(const DimensionType & x, const DimensionType & y, const DimensionType & width, const DimensionType & height) noexcept
+	{
+		return this->getRegion().getRegion(x, y, width, height);
+	}
+
+	// O(1)
+	GridRegion<const ValueType> getRegion(const DimensionType & x, const DimensionType & y, const DimensionType & width, const DimensionType & height) const noexcept
+	{
+		return this->getRegion().getRegion(x, y, width, height);
+	}
+
+	// O(1)
+	// Where cell (x, y) is stored
+	static constexpr IndexType getIndex(const DimensionType & x, const DimensionType & y) noexcept
+	{
+		return MappingType::getIndex(x, y);
+	}
+
+	// O(1)
+	// The index of the cell next to the one at index.
+	// These are cheaper than getIndex, but there is no check for stepping off the edge of the grid.
+	static constexpr IndexType stepLeft(const IndexType & index) noexcept
+	{
+		return MappingType::stepLeft(index);
+	}
+
+	// O(1)
+	static constexpr IndexType stepRight(const IndexType & index) noexcept
+	{
+		return MappingType::stepRight(index);
+	}
+
+	// O(1)
+	static constexpr IndexType stepUp(const IndexType & index) noexcept
+	{
+		return MappingType::stepUp(index);
+	}
+
+	// O(1)
+	static constexpr IndexType stepDown(const IndexType & index) noexcept
+	{
+		return MappingType::stepDown(index);
+	}
+
+	// O(1)
+	// The item at index, as given by getIndex or the step functions
+	STDLIB_CONSTEXPR14 ValueType & operator [](const IndexType & index)
+	{
+		return this->items[index];
+	}
+
+	// O(1)
+	constexpr const ValueType & operator [](const IndexType & index) const
+	{
+		return this->items[index];
+	}
+
+	// O(1)
+	STDLIB_CONSTEXPR14 ValueType & getItem(const DimensionType & x, const DimensionType & y)
+	{
+		return this->items[getIndex(x, y)];
 	}
 	
 	// O(1)
-	const ValueType & getItem(const uint8_t & x, const uint8_t & y) const
+	constexpr const ValueType & getItem(const DimensionType & x, const DimensionType & y) const
 	{
-		return this->items[this->flattenIndex(x, y)];
+		return this->items[getIndex(x, y)];
 	}
 
 	// O(N)
-	void fill(const ValueType & value)
+	STDLIB_CONSTEXPR14 void fill(const ValueType & value)
 	{
-		for(IndexType i = 0; i < Capacity; ++i)
-			items[i] = value;	
+		stdlib::fill(&this->items[0], &this->items[0] + Capacity, value);
+	}
+
+	// O(N)
+	// Fills the cells of getRegion(x, y, width, height)
+	void fillRegion(const DimensionType & x, const DimensionType & y, const DimensionType & width, const DimensionType & height, const ValueType & value)
+	{
+		this->getRegion(x, y, width, height).fill(value);
+	}
+
+	// O(N)
+	// Copies getRegion(sourceX, sourceY, width, height) so that its top left cell goes to (targetX, targetY),
+	// cut short at the edges of the grid. The two rectangles may overlap.
+	void copyRegion(const DimensionType & sourceX, const DimensionType & sourceY, const DimensionType & width, const DimensionType & height, const DimensionType & targetX, const DimensionType & targetY)
+	{
+		this->getRegion(targetX, targetY, width, height).copyFrom(this->getRegion(sourceX, sourceY, width, height));
+	}
+
+	// O(N)
+	// Copies source, which may belong to another grid, so that its top left cell goes to (x, y)
+	void copyRegion(const GridRegion<const ValueType> & source, const DimensionType & x, const DimensionType & y)
+	{
+		this->getRegion().getRegion(x, y, source.getWidth(), source.getHeight()).copyFrom(source);
+	}
+
+	// O(N)
+	// Calls function on each cell of getRegion(x, y, width, height), row by row
+	template< typename Function >
+	void forEachInRegion(const DimensionType & x, const DimensionType & y, const DimensionType & width, const DimensionType & height, Function function)
+	{
+		this->getRegion(x, y, width, height).forEach(function);
+	}
+
+	// O(N)
+	template< typename Function >
+	void forEachInRegion(const DimensionType & x, const DimensionType & y, const DimensionType & width, const DimensionType & height, Function function) const
+	{
+		this->getRegion(x, y, width, height).forEach(function);
 	}
 	
 	// O(N)
@@ -121,4 +342,212 @@ public:
 		for(IndexType i = 0; i < Capacity; ++i)
 			items[i].~ValueType();
 	}
+};
+
+//
+// Bool Grid
+//
+
+// Stores one bit per cell, row by row, so it takes an eighth of the memory
+// and is counted and searched a word at a time.
+// getItem gives a Reference that stands in for a bool &.
+template< uintmax_t WidthValue, uintmax_t HeightValue >
+class Grid<bool, WidthValue, HeightValue>
+{
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using StorageType = BitStorage<WidthValue * HeightValue>;
+
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = bool;
+	using LayoutType = RowMajorLayout;
+	using WordType = typename StorageType::WordType;
+	using Reference = typename StorageType::Reference;
+	using SizeType = typename StorageType::SizeType;
+	using IndexType = typename StorageType::IndexType;
+	using IndexOfType = typename StorageType::IndexOfType;
+	using DimensionType = SmallestUnsignedType<((WidthValue > HeightValue) ? WidthValue : HeightValue)>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const DimensionType Width = WidthValue;
+	constexpr static const DimensionType Height = HeightValue;
+	constexpr static const SizeType Capacity = StorageType::capactiy;
+	constexpr static const IndexOfType InvalidIndex = -1;
+	constexpr static const uintmax_t WordCount = StorageType::wordCount;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	StorageType items;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(N)
+	Grid() = default;
+
+	// O(N)
+	// Items are given row by row, any not given are false
+	constexpr explicit Grid(bool item)
+		: items(item)
+	{
+	}
+
+	// O(N)
+	// Items are given row by row, any not given are false.
+	// In a constexpr context, a value other than 0 or 1 fails to compile.
+	template< typename Other, typename ... Others >
+	constexpr Grid(bool item, const Other & other, const Others & ... others)
+		: items(item, other, others ...)
+	{
+	}
+
+public:
+
+	//
+	// Public Member Functions
+	//
+
+	// O(1)
+	constexpr DimensionType getWidth() const
+	{
+		return Width;
+	}
+
+	// O(1)
+	constexpr DimensionType getHeight() const
+	{
+		return Height;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	// O(1)
+	// The packed words, cell (x, y) is bit N of the whole array where N = (y * width) + x
+	WordType * getWords() noexcept
+	{
+		return this->items.getWords();
+	}
+
+	// O(1)
+	const WordType * getWords() const noexcept
+	{
+		return this->items.getWords();
+	}
+
+	// O(1)
+	Reference getItem(const DimensionType & x, const DimensionType & y)
+	{
+		return this->items[getIndex(x, y)];
+	}
+
+	// O(1)
+	constexpr bool getItem(const DimensionType & x, const DimensionType & y) const
+	{
+		return this->items[getIndex(x, y)];
+	}
+
+	// O(1)
+	// Always row major, so cell (x, y) is bit (y * Width) + x
+	static constexpr IndexType getIndex(const DimensionType & x, const DimensionType & y) noexcept
+	{
+		return static_cast<IndexType>((static_cast<IndexType>(Width) * static_cast<IndexType>(y)) + static_cast<IndexType>(x));
+	}
+
+	// O(1)
+	static constexpr IndexType stepLeft(const IndexType & index) noexcept
+	{
+		return static_cast<IndexType>(index - 1);
+	}
+
+	// O(1)
+	static constexpr IndexType stepRight(const IndexType & index) noexcept
+	{
+		return static_cast<IndexType>(index + 1);
+	}
+
+	// O(1)
+	static constexpr IndexType stepUp(const IndexType & index) noexcept
+	{
+		return static_cast<IndexType>(index - Width);
+	}
+
+	// O(1)
+	static constexpr IndexType stepDown(const IndexType & index) noexcept
+	{
+		return static_cast<IndexType>(index + Width);
+	}
+
+	// O(1)
+	Reference operator [](const IndexType & index)
+	{
+		return this->items[index];
+	}
+
+	// O(1)
+	constexpr bool operator [](const IndexType & index) const
+	{
+		return this->items[index];
+	}
+
+	// O(N)
+	void fill(bool value)
+	{
+		this->items.fill(value);
+	}
+
+	// O(N)
+	// Sets every cell to false
+	void clear()
+	{
+		this->items.fill(false);
+	}
+
+	// O(N)
+	bool contains(bool value) const
+	{
+		return (this->items.indexOfFirst(value) != InvalidIndex);
+	}
+
+	// O(N)
+	SizeType count(bool value) const
+	{
+		return this->items.count(value);
+	}
+
+	// O(N)
+	// Returns (y * width) + x for the first matching cell, or -1 if there is none
+	IndexOfType indexOfFirst(bool value) const
+	{
+		return this->items.indexOfFirst(value);
+	}
+
+	// O(N)
+	// Returns (y * width) + x for the last matching cell, or -1 if there is none
+	IndexOfType indexOfLast(bool value) const
+	{
+		return this->items.indexOfLast(value);
+	}
 };
\ No newline at end of file
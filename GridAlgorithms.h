@@ -0,0 +1,390 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Flood fill and distance maps for Grid.
+// Nothing recurses, the work lists are fixed size containers
+// whose capacity is a template argument, so the memory used is known at compile time.
+// Cells are reached with the layout's step functions rather than getItem,
+// so each neighbour costs an add rather than a multiply.
+
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Grid.h"
+#include "Stack.h"
+#include "CircularDeque.h"
+
+//
+// Neighbourhoods
+//
+
+// The cells that share an edge with a cell
+struct FourNeighbours
+{
+	constexpr static const uint8_t Count = 4;
+
+	template< uint8_t index >
+	struct Offset;
+};
+
+template<> struct FourNeighbours::Offset<0> { constexpr static const int8_t X = 1; constexpr static const int8_t Y = 0; };
+template<> struct FourNeighbours::Offset<1> { constexpr static const int8_t X = -1; constexpr static const int8_t Y = 0; };
+template<> struct FourNeighbours::Offset<2> { constexpr static const int8_t X = 0; constexpr static const int8_t Y = 1; };
+template<> struct FourNeighbours::Offset<3> { constexpr static const int8_t X = 0; constexpr static const int8_t Y = -1; };
+
+// The cells that share an edge or a corner with a cell
+struct EightNeighbours
+{
+	constexpr static const uint8_t Count = 8;
+
+	template< uint8_t index >
+	struct Offset;
+};
+
+template<> struct EightNeighbours::Offset<0> { constexpr static const int8_t X = 1; constexpr static const int8_t Y = 0; };
+template<> struct EightNeighbours::Offset<1> { constexpr static const int8_t X = -1; constexpr static const int8_t Y = 0; };
+template<> struct EightNeighbours::Offset<2> { constexpr static const int8_t X = 0; constexpr static const int8_t Y = 1; };
+template<> struct EightNeighbours::Offset<3> { constexpr static const int8_t X = 0; constexpr static const int8_t Y = -1; };
+template<> struct EightNeighbours::Offset<4> { constexpr static const int8_t X = 1; constexpr static const int8_t Y = 1; };
+template<> struct EightNeighbours::Offset<5> { constexpr static const int8_t X = -1; constexpr static const int8_t Y = 1; };
+template<> struct EightNeighbours::Offset<6> { constexpr static const int8_t X = 1; constexpr static const int8_t Y = -1; };
+template<> struct EightNeighbours::Offset<7> { constexpr static const int8_t X = -1; constexpr static const int8_t Y = -1; };
+
+//
+// Distances
+//
+
+// The distance computeDistanceMap gives to cells that no source can reach
+template< typename Distance >
+constexpr Distance getUnreachedDistance() noexcept
+{
+	return static_cast<Distance>(~static_cast<Distance>(0));
+}
+
+// A cell's coordinates
+template< typename Dimension >
+struct GridPoint
+{
+	Dimension x;
+	Dimension y;
+};
+
+namespace details
+{
+	// O(1)
+	// Whether (x, y) has a neighbour at the offset (offsetX, offsetY)
+	template< typename GridType, int8_t offsetX, int8_t offsetY, typename Dimension >
+	constexpr bool hasNeighbour(Dimension x, Dimension y) noexcept
+	{
+		return ((offsetX >= 0) || (x > 0)) && ((offsetX <= 0) || (x < (GridType::Width - 1))) &&
+			((offsetY >= 0) || (y > 0)) && ((offsetY <= 0) || (y < (GridType::Height - 1)));
+	}
+
+	// O(1)
+	// The offsets are constants, so all but the needed steps are compiled away
+	template< typename GridType, int8_t offsetX, int8_t offsetY, typename Index >
+	constexpr Index stepToNeighbour(Index index) noexcept
+	{
+		return (offsetY > 0) ? stepToNeighbour<GridType, offsetX, 0>(GridType::stepDown(index)) :
+			(offsetY < 0) ? stepToNeighbour<GridType, offsetX, 0>(GridType::stepUp(index)) :
+			(offsetX > 0) ? GridType::stepRight(index) :
+			(offsetX < 0) ? GridType::stepLeft(index) :
+			index;
+	}
+
+	// Calls visitor.visit<Direction, X, Y>() for each offset in the neighbourhood,
+	// where Direction is the offset's index, unrolled by recursion so that every offset is a constant
+	template< typename Neighbourhood, uint8_t index = 0, bool active = (index < Neighbourhood::Count) >
+	struct NeighbourLoop
+	{
+		template< typename Visitor >
+		static void apply(Visitor & visitor)
+		{
+			using OffsetType = typename Neighbourhood::template Offset<index>;
+
+			visitor.template visit<index, OffsetType::X, OffsetType::Y>();
+			NeighbourLoop<Neighbourhood, index + 1>::apply(visitor);
+		}
+	};
+
+	template< typename Neighbourhood, uint8_t index >
+	struct NeighbourLoop<Neighbourhood, index, false>
+	{
+		template< typename Visitor >
+		static void apply(Visitor &)
+		{
+		}
+	};
+
+	// Gives each unreached, passable neighbour of one cell the next distance and queues it
+	template< typename GridType, typename DistanceGridType, typename IsPassable, typename Queue >
+	struct DistanceVisitor
+	{
+		using IndexType = typename GridType::IndexType;
+		using DimensionType = typename GridType::DimensionType;
+		using DistanceType = typename DistanceGridType::ValueType;
+
+		const GridType & grid;
+		DistanceGridType & distances;
+		IsPassable & isPassable;
+		Queue & queue;
+		bool & overflowed;
+		DimensionType x;
+		DimensionType y;
+		IndexType index;
+		DistanceType distance;
+
+		template< uint8_t, int8_t offsetX, int8_t offsetY >
+		void visit()
+		{
+			if (!hasNeighbour<GridType, offsetX, offsetY>(this->x, this->y))
+				return;
+
+			const IndexType neighbour = stepToNeighbour<GridType, offsetX, offsetY>(this->index);
+
+			if ((this->distances[neighbour] != getUnreachedDistance<DistanceType>()) || !this->isPassable(this->grid[neighbour]))
+				return;
+
+			this->distances[neighbour] = this->distance;
+
+			const GridPoint<DimensionType> point { static_cast<DimensionType>(this->x + offsetX), static_cast<DimensionType>(this->y + offsetY) };
+
+			if (!this->queue.append(point))
+				this->overflowed = true;
+		}
+	};
+
+	// Lowers each passable neighbour of one cell to the next distance if that is shorter
+	template< typename GridType, typename DistanceGridType, typename IsPassable >
+	struct RelaxVisitor
+	{
+		using IndexType = typename GridType::IndexType;
+		using DimensionType = typename GridType::DimensionType;
+		using DistanceType = typename DistanceGridType::ValueType;
+
+		const GridType & grid;
+		DistanceGridType & distances;
+		IsPassable & isPassable;
+		bool & changed;
+		DimensionType x;
+		DimensionType y;
+		IndexType index;
+		DistanceType distance;
+
+		template< uint8_t, int8_t offsetX, int8_t offsetY >
+		void visit()
+		{
+			if (!hasNeighbour<GridType, offsetX, offsetY>(this->x, this->y))
+				return;
+
+			const IndexType neighbour = stepToNeighbour<GridType, offsetX, offsetY>(this->index);
+
+			if ((this->distances[neighbour] <= this->distance) || !this->isPassable(this->grid[neighbour]))
+				return;
+
+			this->distances[neighbour] = this->distance;
+			this->changed = true;
+		}
+	};
+
+	// O(N * D)
+	// Used when the queue ran out of room, so some cells were never expanded.
+	// Every distance already found is the length of a real path,
+	// so sweeping until nothing shortens leaves the true distances.
+	template< typename Neighbourhood, typename GridType, typename DistanceGridType, typename IsPassable >
+	void relaxDistances(const GridType & grid, DistanceGridType & distances, IsPassable & isPassable)
+	{
+		using DimensionType = typename GridType::DimensionType;
+		using DistanceType = typename DistanceGridType::ValueType;
+
+		for (bool changed = true; changed;)
+		{
+			changed = false;
+
+			for (DimensionType y = 0; y < GridType::Height; ++y)
+				for (DimensionType x = 0; x < GridType::Width; ++x)
+				{
+					const auto index = GridType::getIndex(x, y);
+					const DistanceType distance = distances[index];
+
+					if (distance >= static_cast<DistanceType>(getUnreachedDistance<DistanceType>() - 1))
+						continue;
+
+					RelaxVisitor<GridType, DistanceGridType, IsPassable> visitor { grid, distances, isPassable, changed, x, y, index, static_cast<DistanceType>(distance + 1) };
+					NeighbourLoop<Neighbourhood>::apply(visitor);
+				}
+		}
+	}
+}
+
+// O(N)
+// Breadth first search from every source at once.
+// The sources are the cells of distances that are 0 when called.
+// Every other cell of distances is overwritten with the number of steps to the nearest source,
+// moving only through cells of grid for which isPassable returns true,
+// or getUnreachedDistance<Distance>() if there is no way to a source.
+// Distance must be unsigned, and distances that would reach getUnreachedDistance are left unreached.
+// The queue holds queueCapacity cells. If it runs out of room the result is still exact,
+// but finishing off takes extra sweeps over the whole grid, so size it to the widest expected frontier.
+template< typename Neighbourhood, uintmax_t queueCapacity, typename Type, uintmax_t width, uintmax_t height, typename Layout, typename Distance, typename IsPassable >
+void computeDistanceMap(const Grid<Type, width, height, Layout> & grid, Grid<Distance, width, height, Layout> & distances, IsPassable isPassable)
+{
+	static_assert(stdlib::is_unsigned<Distance>::value, "computeDistanceMap needs an unsigned Distance");
+	static_assert(queueCapacity > 0, "computeDistanceMap needs a queue capacity of at least 1");
+
+	using GridType = Grid<Type, width, height, Layout>;
+	using DistanceGridType = Grid<Distance, width, height, Layout>;
+	using DimensionType = typename GridType::DimensionType;
+	using PointType = GridPoint<DimensionType>;
+	using QueueType = CircularDeque<PointType, queueCapacity>;
+
+	QueueType queue;
+	bool overflowed = false;
+
+	for (DimensionType y = 0; y < height; ++y)
+		for (DimensionType x = 0; x < width; ++x)
+		{
+			Distance & distance = distances.getItem(x, y);
+
+			if (distance != 0)
+				distance = getUnreachedDistance<Distance>();
+			else if (!queue.append(PointType { x, y }))
+				overflowed = true;
+		}
+
+	while (!queue.isEmpty())
+	{
+		const PointType point = queue.getFirst();
+		queue.unprepend();
+
+		const auto index = GridType::getIndex(point.x, point.y);
+		const Distance distance = distances[index];
+
+		if (distance >= static_cast<Distance>(getUnreachedDistance<Distance>() - 1))
+			continue;
+
+		details::DistanceVisitor<GridType, DistanceGridType, IsPassable, QueueType> visitor { grid, distances, isPassable, queue, overflowed, point.x, point.y, index, static_cast<Distance>(distance + 1) };
+		details::NeighbourLoop<Neighbourhood>::apply(visitor);
+	}
+
+	if (overflowed)
+		details::relaxDistances<Neighbourhood>(grid, distances, isPassable);
+}
+
+// O(N)
+// The queue holds (width + height) * 2 cells, which is enough for a single source on an open grid
+template< typename Neighbourhood = FourNeighbours, typename Type, uintmax_t width, uintmax_t height, typename Layout, typename Distance, typename IsPassable >
+void computeDistanceMap(const Grid<Type, width, height, Layout> & grid, Grid<Distance, width, height, Layout> & distances, IsPassable isPassable)
+{
+	computeDistanceMap<Neighbourhood, ((width + height) * 2)>(grid, distances, isPassable);
+}
+
+//
+// Flood Fill
+//
+
+// O(N)
+// Replaces every cell that is equal to the cell at (x, y) and joined to it by cells that share an edge.
+// Works a row at a time: each run of matching cells is filled from left to right,
+// and only the first cell of each matching run above and below it is kept for later.
+// The seed stack holds stackCapacity cells. Returns false if it ran out of room,
+// in which case part of the area may have been left unfilled.
+template< uintmax_t stackCapacity, typename Type, uintmax_t width, uintmax_t height, typename Layout >
+bool floodFill(Grid<Type, width, height, Layout> & grid, typename Grid<Type, width, height, Layout>::DimensionType x, typename Grid<Type, width, height, Layout>::DimensionType y, const Type & replacement)
+{
+	static_assert(stackCapacity > 0, "floodFill needs a stack capacity of at least 1");
+
+	using GridType = Grid<Type, width, height, Layout>;
+	using IndexType = typename GridType::IndexType;
+	using DimensionType = typename GridType::DimensionType;
+	using PointType = GridPoint<DimensionType>;
+
+	if ((x >= width) || (y >= height))
+		return true;
+
+	// Copied, because the cell it comes from is about to be overwritten
+	const Type target = grid.getItem(x, y);
+
+	if (target == replacement)
+		return true;
+
+	Stack<PointType, stackCapacity> seeds;
+	seeds.push(PointType { x, y });
+
+	bool overflowed = false;
+
+	while (!seeds.isEmpty())
+	{
+		const PointType seed = seeds.peek();
+		seeds.drop();
+
+		IndexType index = GridType::getIndex(seed.x, seed.y);
+
+		// Already filled from another seed
+		if (!(grid[index] == target))
+			continue;
+
+		DimensionType left = seed.x;
+
+		for (; (left > 0) && (grid[GridType::stepLeft(index)] == target); --left)
+			index = GridType::stepLeft(index);
+
+		bool inRunAbove = false;
+		bool inRunBelow = false;
+
+		for (DimensionType current = left;; ++current)
+		{
+			grid[index] = replacement;
+
+			if (seed.y > 0)
+			{
+				const bool matches = (grid[GridType::stepUp(index)] == target);
+
+				if (matches && !inRunAbove && !seeds.push(PointType { current, static_cast<DimensionType>(seed.y - 1) }))
+					overflowed = true;
+
+				inRunAbove = matches;
+			}
+
+			if (seed.y < (height - 1))
+			{
+				const bool matches = (grid[GridType::stepDown(index)] == target);
+
+				if (matches && !inRunBelow && !seeds.push(PointType { current, static_cast<DimensionType>(seed.y + 1) }))
+					overflowed = true;
+
+				inRunBelow = matches;
+			}
+
+			if ((current >= (width - 1)) || !(grid[GridType::stepRight(index)] == target))
+				break;
+
+			index = GridType::stepRight(index);
+		}
+	}
+
+	return !overflowed;
+}
+
+// O(N)
+// The seed stack holds width + height cells
+template< typename Type, uintmax_t width, uintmax_t height, typename Layout >
+bool floodFill(Grid<Type, width, height, Layout> & grid, typename Grid<Type, width, height, Layout>::DimensionType x, typename Grid<Type, width, height, Layout>::DimensionType y, const Type & replacement)
+{
+	return floodFill<(width + height)>(grid, x, y, replacement);
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// The ways a Grid can arrange its cells in memory.
+// Each layout has a Mapping<Width, Height> that says how many items it stores,
+// where cell (x, y) goes, and how to step from a cell's index to a neighbour's
+// without working out the neighbour's index from scratch.
+// Stepping off the edge of the grid gives a meaningless index.
+
+#include <stdint.h>
+
+#include "IntegerTypes.h"
+
+//
+// Declarations
+//
+
+struct RowMajorLayout;
+
+struct MortonLayout;
+
+template< uintmax_t tileSize >
+struct TiledLayout;
+
+//
+// RowMajorLayout
+//
+
+// Row by row, so each row is contiguous.
+// This is the default, and the only layout that has rows and regions as views.
+struct RowMajorLayout
+{
+	template< uintmax_t width, uintmax_t height >
+	class Mapping
+	{
+	public:
+		constexpr static const uintmax_t StorageSize = (width * height);
+
+		using IndexType = SmallestUnsignedType<StorageSize>;
+
+		// O(1)
+		static constexpr IndexType getIndex(uintmax_t x, uintmax_t y) noexcept
+		{
+			return static_cast<IndexType>((width * y) + x);
+		}
+
+		// O(1)
+		static constexpr IndexType stepLeft(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(index - 1);
+		}
+
+		// O(1)
+		static constexpr IndexType stepRight(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(index + 1);
+		}
+
+		// O(1)
+		static constexpr IndexType stepUp(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(index - width);
+		}
+
+		// O(1)
+		static constexpr IndexType stepDown(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(index + width);
+		}
+	};
+};
+
+//
+// MortonLayout
+//
+
+namespace details
+{
+	// O(1)
+	constexpr uint32_t spreadBitsStep(uint32_t value, uint8_t shift, uint32_t mask) noexcept
+	{
+		return ((value | (value << shift)) & mask);
+	}
+
+	// O(1)
+	// Moves bit N of the low 16 bits of value to bit 2N
+	constexpr uint32_t spreadBits(uint32_t value) noexcept
+	{
+		return spreadBitsStep(spreadBitsStep(spreadBitsStep(spreadBitsStep((value & 0xFFFF), 8, 0x00FF00FF), 4, 0x0F0F0F0F), 2, 0x33333333), 1, 0x55555555);
+	}
+}
+
+// Z-order: the bits of x and y are interleaved, with x in the even bits,
+// so cells that are near each other in both directions tend to be near each other in memory.
+// The grid is padded out to a square with a power of two side,
+// so it suits square grids with power of two sides best.
+struct MortonLayout
+{
+	template< uintmax_t width, uintmax_t height >
+	class Mapping
+	{
+	private:
+		constexpr static const uintmax_t Side = details::nextPowerOfTwo((width > height) ? width : height);
+
+		static_assert(Side <= 0x10000, "MortonLayout only supports sides of up to 65536 cells");
+
+	public:
+		constexpr static const uintmax_t StorageSize = (Side * Side);
+
+		using IndexType = SmallestUnsignedType<StorageSize>;
+
+	private:
+		// The bits that hold x and the bits that hold y
+		constexpr static const IndexType XMask = static_cast<IndexType>(UINT64_C(0x5555555555555555) & (StorageSize - 1));
+		constexpr static const IndexType YMask = static_cast<IndexType>(UINT64_C(0xAAAAAAAAAAAAAAAA) & (StorageSize - 1));
+
+	public:
+		// O(1)
+		static constexpr IndexType getIndex(uintmax_t x, uintmax_t y) noexcept
+		{
+			return static_cast<IndexType>(details::spreadBits(static_cast<uint32_t>(x)) | (details::spreadBits(static_cast<uint32_t>(y)) << 1));
+		}
+
+		// O(1)
+		// Setting the y bits lets the carry from adding one skip over them
+		static constexpr IndexType stepRight(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index | YMask) + 1) & XMask) | (index & YMask));
+		}
+
+		// O(1)
+		// Clearing the y bits lets the borrow from subtracting one skip over them
+		static constexpr IndexType stepLeft(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index & XMask) - 1) & XMask) | (index & YMask));
+		}
+
+		// O(1)
+		static constexpr IndexType stepDown(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index | XMask) + 1) & YMask) | (index & XMask));
+		}
+
+		// O(1)
+		static constexpr IndexType stepUp(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index & YMask) - 1) & YMask) | (index & XMask));
+		}
+	};
+};
+
+//
+// TiledLayout
+//
+
+// Square tiles of tileSize by tileSize cells, each stored row by row,
+// with the tiles themselves stored row by row.
+// A 3x3 neighbourhood then mostly falls within one tile.
+// tileSize must be a power of two, and the grid is padded out to a whole number of tiles.
+template< uintmax_t tileSize >
+struct TiledLayout
+{
+	static_assert(details::isPowerOfTwo(tileSize), "TiledLayout tile size must be a power of two");
+
+	template< uintmax_t width, uintmax_t height >
+	class Mapping
+	{
+	private:
+		constexpr static const uintmax_t TilesAcross = ((width + (tileSize - 1)) / tileSize);
+		constexpr static const uintmax_t TilesDown = ((height + (tileSize - 1)) / tileSize);
+		constexpr static const uintmax_t TileArea = (tileSize * tileSize);
+		constexpr static const uintmax_t TileRowSize = (TilesAcross * TileArea);
+		constexpr static const uint8_t TileShift = details::floorLog2(tileSize);
+		constexpr static const uintmax_t TileMask = (tileSize - 1);
+
+	public:
+		constexpr static const uintmax_t StorageSize = (TilesDown * TileRowSize);
+
+		using IndexType = SmallestUnsignedType<StorageSize>;
+
+		// O(1)
+		static constexpr IndexType getIndex(uintmax_t x, uintmax_t y) noexcept
+		{
+			return static_cast<IndexType>(((y >> TileShift) * TileRowSize) + ((x >> TileShift) * TileArea) + ((y & TileMask) << TileShift) + (x & TileMask));
+		}
+
+		// O(1)
+		static constexpr IndexType stepRight(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(((index & TileMask) != TileMask) ? (index + 1) : (index + TileArea - TileMask));
+		}
+
+		// O(1)
+		static constexpr IndexType stepLeft(IndexType index) noexcept
+		{
+			return static_cast<IndexType>(((index & TileMask) != 0) ? (index - 1) : (index - TileArea + TileMask));
+		}
+
+		// O(1)
+		static constexpr IndexType stepDown(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index >> TileShift) & TileMask) != TileMask) ? (index + tileSize) : (index + TileRowSize - (TileMask << TileShift)));
+		}
+
+		// O(1)
+		static constexpr IndexType stepUp(IndexType index) noexcept
+		{
+			return static_cast<IndexType>((((index >> TileShift) & TileMask) != 0) ? (index - tileSize) : (index - TileRowSize + (TileMask << TileShift)));
+		}
+	};
+};
\ No newline at end of file
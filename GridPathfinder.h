@@ -0,0 +1,531 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A* search over a Grid, which becomes Dijkstra's algorithm with ZeroHeuristic.
+// The open set is a PriorityQueue, so taking the best cell is O(log M) instead of a scan,
+// and a cell that is reached again by a cheaper path has its entry moved up with decreaseKey.
+// A search can be spread over several frames by calling step with a budget each frame.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Array.h"
+#include "PriorityQueue.h"
+#include "GridAlgorithms.h"
+
+//
+// Declarations
+//
+
+enum class PathfinderStatus : uint8_t;
+
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood = FourNeighbours, typename Cost = uint16_t >
+class GridPathfinder;
+
+//
+// Heuristics
+//
+
+// The distance with straight steps only, suits FourNeighbours
+template< uintmax_t straightCost = 1 >
+struct ManhattanHeuristic
+{
+	template< typename Dimension >
+	constexpr uintmax_t operator()(Dimension distanceX, Dimension distanceY) const noexcept
+	{
+		return ((static_cast<uintmax_t>(distanceX) + static_cast<uintmax_t>(distanceY)) * straightCost);
+	}
+};
+
+// The distance with as many diagonal steps as possible, suits EightNeighbours
+template< uintmax_t straightCost = 10, uintmax_t diagonalCost = 14 >
+struct OctileHeuristic
+{
+	template< typename Dimension >
+	constexpr uintmax_t operator()(Dimension distanceX, Dimension distanceY) const noexcept
+	{
+		return (distanceX < distanceY) ?
+			((static_cast<uintmax_t>(distanceX) * diagonalCost) + (static_cast<uintmax_t>(distanceY - distanceX) * straightCost)) :
+			((static_cast<uintmax_t>(distanceY) * diagonalCost) + (static_cast<uintmax_t>(distanceX - distanceY) * straightCost));
+	}
+};
+
+// No estimate at all, which makes the search Dijkstra's algorithm
+struct ZeroHeuristic
+{
+	template< typename Dimension >
+	constexpr uintmax_t operator()(Dimension, Dimension) const noexcept
+	{
+		return 0;
+	}
+};
+
+//
+// PathfinderStatus
+//
+
+enum class PathfinderStatus : uint8_t
+{
+	// No search has been started
+	Idle,
+
+	// step needs to be called again
+	Searching,
+
+	// A path was found
+	Found,
+
+	// The goal can't be reached from the start
+	NoPath,
+
+	// The open set ran out of room, so the search gave up
+	OpenSetFull,
+};
+
+//
+// details::NeighbourOffsetAt
+//
+
+namespace details
+{
+	// O(D)
+	// The offset with the given index in the neighbourhood, for when the index isn't a constant
+	template< typename Neighbourhood, uint8_t index = 0, bool active = (index < Neighbourhood::Count) >
+	struct NeighbourOffsetAt
+	{
+		static constexpr int8_t getX(uint8_t direction) noexcept
+		{
+			return (direction == index) ? static_cast<int8_t>(Neighbourhood::template Offset<index>::X) : NeighbourOffsetAt<Neighbourhood, index + 1>::getX(direction);
+		}
+
+		static constexpr int8_t getY(uint8_t direction) noexcept
+		{
+			return (direction == index) ? static_cast<int8_t>(Neighbourhood::template Offset<index>::Y) : NeighbourOffsetAt<Neighbourhood, index + 1>::getY(direction);
+		}
+	};
+
+	template< typename Neighbourhood, uint8_t index >
+	struct NeighbourOffsetAt<Neighbourhood, index, false>
+	{
+		static constexpr int8_t getX(uint8_t) noexcept
+		{
+			return 0;
+		}
+
+		static constexpr int8_t getY(uint8_t) noexcept
+		{
+			return 0;
+		}
+	};
+}
+
+//
+// GridPathfinder
+//
+
+// Finds the cheapest path between two cells of a GridType, which may use any layout or be a Grid<bool>.
+// stepCost(cell, diagonal) gives the cost of stepping onto a cell,
+// or a value of at least ImpassableCost if the cell can't be entered.
+// heuristic(distanceX, distanceY) estimates the cost of the rest of the way,
+// and must never estimate more than the true cost or the path found may not be the cheapest.
+// openCapacity is the number of cells that can be waiting to be searched at once.
+// Each cell of the grid costs one byte of state, one Cost and one open set handle.
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+class GridPathfinder
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(stdlib::is_unsigned<Cost>::value, "GridPathfinder needs an unsigned Cost");
+	static_assert(Neighbourhood::Count <= 8, "GridPathfinder stores each cell's parent direction in 3 bits");
+
+	//
+	// Type Aliases
+	//
+
+	using CellType = typename GridType::ValueType;
+	using CostType = Cost;
+	using StepCostType = StepCost;
+	using HeuristicType = Heuristic;
+	using NeighbourhoodType = Neighbourhood;
+	using SizeType = typename GridType::SizeType;
+	using IndexType = typename GridType::IndexType;
+	using DimensionType = typename GridType::DimensionType;
+	using PointType = GridPoint<DimensionType>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const CostType ImpassableCost = getUnreachedDistance<CostType>();
+
+private:
+
+	//
+	// Private Types
+	//
+
+	struct OpenEntry
+	{
+		// The cost so far plus the estimate
+		CostType estimate;
+
+		// The estimate alone, which breaks ties in favour of the cell nearer the goal
+		CostType remaining;
+
+		DimensionType x;
+		DimensionType y;
+	};
+
+	struct OpenEntryCompare
+	{
+		bool operator()(const OpenEntry & left, const OpenEntry & right) const noexcept
+		{
+			return (left.estimate < right.estimate) || ((left.estimate == right.estimate) && (left.remaining < right.remaining));
+		}
+	};
+
+	using OpenSetType = PriorityQueue<OpenEntry, openCapacity, OpenEntryCompare>;
+	using HandleType = typename OpenSetType::HandleType;
+
+	// Calls relax for each neighbour of one cell that is within the grid
+	struct ExpandVisitor
+	{
+		GridPathfinder & pathfinder;
+		DimensionType x;
+		DimensionType y;
+		IndexType index;
+		CostType cost;
+
+		template< uint8_t direction, int8_t offsetX, int8_t offsetY >
+		void visit()
+		{
+			if (!details::hasNeighbour<GridType, offsetX, offsetY>(this->x, this->y))
+				return;
+
+			const IndexType neighbour = details::stepToNeighbour<GridType, offsetX, offsetY>(this->index);
+			this->pathfinder.relax(neighbour, static_cast<DimensionType>(this->x + offsetX), static_cast<DimensionType>(this->y + offsetY), direction, ((offsetX != 0) && (offsetY != 0)), this->cost);
+		}
+	};
+
+	//
+	// Private Constants
+	//
+
+	// Each cell's state is one byte:
+	// the direction of the step that reached it in the low 3 bits, then the flags
+	constexpr static const uint8_t DirectionMask = 0x07;
+	constexpr static const uint8_t ReachedFlag = 0x08;
+	constexpr static const uint8_t OpenFlag = 0x10;
+	constexpr static const uint8_t ClosedFlag = 0x20;
+
+	//
+	// Member Variables
+	//
+
+	StepCostType stepCost;
+	HeuristicType heuristic;
+
+	const GridType * grid = nullptr;
+	OpenSetType openSet;
+
+	// Indexed the same way as the grid.
+	// A cell's cost and handle are only meaningful while its state says so,
+	// so starting a search only has to clear the states.
+	Array<uint8_t, GridType::Capacity> states;
+	Array<CostType, GridType::Capacity> costs;
+	Array<HandleType, GridType::Capacity> handles;
+
+	PointType start {};
+	PointType goal {};
+	PathfinderStatus status = PathfinderStatus::Idle;
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	OpenEntry makeEntry(DimensionType x, DimensionType y, CostType cost) const;
+
+	// O(log M)
+	// Offers a path to the cell at index that costs cost to get to its neighbour and then steps in direction
+	void relax(IndexType index, DimensionType x, DimensionType y, uint8_t direction, bool diagonal, CostType cost);
+
+	// O(1)
+	// The cell the path to point came from
+	PointType getParent(const PointType & point) const;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(N)
+	explicit GridPathfinder(const StepCostType & stepCost = StepCostType(), const HeuristicType & heuristic = HeuristicType())
+		: stepCost(stepCost), heuristic(heuristic)
+	{
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(N)
+	// Starts a new search from (startX, startY) to (goalX, goalY).
+	// grid must not change or move until the search is finished.
+	// Gives NoPath straight away if either cell is outside the grid or the goal can't be entered.
+	PathfinderStatus begin(const GridType & grid, DimensionType startX, DimensionType startY, DimensionType goalX, DimensionType goalY);
+
+	// O(B log M)
+	// Searches up to budget cells, then returns the status
+	PathfinderStatus step(size_t budget);
+
+	// O(N log M)
+	// Searches until the search is finished
+	PathfinderStatus run();
+
+	// O(M)
+	// Abandons the search
+	void cancel();
+
+	// O(1)
+	PathfinderStatus getStatus() const noexcept
+	{
+		return this->status;
+	}
+
+	// O(1)
+	bool isSearching() const noexcept
+	{
+		return (this->status == PathfinderStatus::Searching);
+	}
+
+	// O(1)
+	// The total step cost of the path found.
+	// Return result is undefined unless the status is Found.
+	CostType getPathCost() const
+	{
+		return this->costs[GridType::getIndex(this->goal.x, this->goal.y)];
+	}
+
+	// O(L)
+	// The number of steps on the path found, or 0 unless the status is Found
+	size_t getPathLength() const;
+
+	// O(L)
+	// Writes up to count cells of the path found, in order,
+	// starting with the first step after the start and ending with the goal.
+	// Returns the number written.
+	size_t getPath(PointType * points, size_t count) const;
+};
+
+//
+// Definition
+//
+
+// O(1)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+auto GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::makeEntry(DimensionType x, DimensionType y, CostType cost) const -> OpenEntry
+{
+	const DimensionType distanceX = (x < this->goal.x) ? static_cast<DimensionType>(this->goal.x - x) : static_cast<DimensionType>(x - this->goal.x);
+	const DimensionType distanceY = (y < this->goal.y) ? static_cast<DimensionType>(this->goal.y - y) : static_cast<DimensionType>(y - this->goal.y);
+
+	const uintmax_t estimate = this->heuristic(distanceX, distanceY);
+	const CostType remaining = (estimate < ImpassableCost) ? static_cast<CostType>(estimate) : ImpassableCost;
+	const CostType total = (remaining < (ImpassableCost - cost)) ? static_cast<CostType>(cost + remaining) : ImpassableCost;
+
+	return OpenEntry { total, remaining, x, y };
+}
+
+// O(log M)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+void GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::relax(IndexType index, DimensionType x, DimensionType y, uint8_t direction, bool diagonal, CostType cost)
+{
+	const uint8_t state = this->states[index];
+
+	if ((state & ClosedFlag) != 0)
+		return;
+
+	const uintmax_t step = this->stepCost((*this->grid)[index], diagonal);
+
+	// Written so that the sum can't overflow
+	if ((step >= ImpassableCost) || (step >= static_cast<uintmax_t>(ImpassableCost - cost)))
+		return;
+
+	const CostType newCost = static_cast<CostType>(cost + step);
+
+	if (((state & ReachedFlag) != 0) && (newCost >= this->costs[index]))
+		return;
+
+	this->costs[index] = newCost;
+
+	if ((state & OpenFlag) != 0)
+	{
+		this->openSet.decreaseKey(this->handles[index], this->makeEntry(x, y, newCost));
+	}
+	else
+	{
+		const auto handle = this->openSet.pushWithHandle(this->makeEntry(x, y, newCost));
+
+		if (handle == OpenSetType::InvalidHandle)
+		{
+			this->status = PathfinderStatus::OpenSetFull;
+			return;
+		}
+
+		this->handles[index] = static_cast<HandleType>(handle);
+	}
+
+	this->states[index] = static_cast<uint8_t>(ReachedFlag | OpenFlag | direction);
+}
+
+// O(1)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+auto GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::getParent(const PointType & point) const -> PointType
+{
+	using OffsetType = details::NeighbourOffsetAt<Neighbourhood>;
+
+	const uint8_t direction = static_cast<uint8_t>(this->states[GridType::getIndex(point.x, point.y)] & DirectionMask);
+
+	return PointType { static_cast<DimensionType>(point.x - OffsetType::getX(direction)), static_cast<DimensionType>(point.y - OffsetType::getY(direction)) };
+}
+
+// O(N)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+PathfinderStatus GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::begin(const GridType & grid, DimensionType startX, DimensionType startY, DimensionType goalX, DimensionType goalY)
+{
+	this->openSet.clear();
+	this->states.fill(0);
+
+	this->grid = &grid;
+	this->start = PointType { startX, startY };
+	this->goal = PointType { goalX, goalY };
+
+	if ((startX >= GridType::Width) || (startY >= GridType::Height) || (goalX >= GridType::Width) || (goalY >= GridType::Height))
+	{
+		this->status = PathfinderStatus::NoPath;
+		return this->status;
+	}
+
+	// Saves searching every reachable cell for a goal that can never be entered
+	if (static_cast<uintmax_t>(this->stepCost(grid.getItem(goalX, goalY), false)) >= ImpassableCost)
+	{
+		this->status = PathfinderStatus::NoPath;
+		return this->status;
+	}
+
+	const IndexType index = GridType::getIndex(startX, startY);
+
+	this->costs[index] = 0;
+	this->handles[index] = static_cast<HandleType>(this->openSet.pushWithHandle(this->makeEntry(startX, startY, 0)));
+	this->states[index] = static_cast<uint8_t>(ReachedFlag | OpenFlag);
+
+	this->status = PathfinderStatus::Searching;
+	return this->status;
+}
+
+// O(B log M)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+PathfinderStatus GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::step(size_t budget)
+{
+	for (; (budget > 0) && (this->status == PathfinderStatus::Searching); --budget)
+	{
+		if (this->openSet.isEmpty())
+		{
+			this->status = PathfinderStatus::NoPath;
+			break;
+		}
+
+		const OpenEntry entry = this->openSet.peek();
+		this->openSet.pop();
+
+		const IndexType index = GridType::getIndex(entry.x, entry.y);
+		this->states[index] = static_cast<uint8_t>((this->states[index] & ~OpenFlag) | ClosedFlag);
+
+		if ((entry.x == this->goal.x) && (entry.y == this->goal.y))
+		{
+			this->status = PathfinderStatus::Found;
+			break;
+		}
+
+		ExpandVisitor visitor { *this, entry.x, entry.y, index, this->costs[index] };
+		details::NeighbourLoop<Neighbourhood>::apply(visitor);
+	}
+
+	return this->status;
+}
+
+// O(N log M)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+PathfinderStatus GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::run()
+{
+	while (this->status == PathfinderStatus::Searching)
+		this->step(GridType::Capacity);
+
+	return this->status;
+}
+
+// O(M)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+void GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::cancel()
+{
+	this->openSet.clear();
+	this->status = PathfinderStatus::Idle;
+}
+
+// O(L)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+size_t GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::getPathLength() const
+{
+	if (this->status != PathfinderStatus::Found)
+		return 0;
+
+	size_t length = 0;
+
+	for (PointType point = this->goal; (point.x != this->start.x) || (point.y != this->start.y); point = this->getParent(point))
+		++length;
+
+	return length;
+}
+
+// O(L)
+template< typename GridType, uintmax_t openCapacity, typename StepCost, typename Heuristic, typename Neighbourhood, typename Cost >
+size_t GridPathfinder<GridType, openCapacity, StepCost, Heuristic, Neighbourhood, Cost>::getPath(PointType * points, size_t count) const
+{
+	const size_t length = this->getPathLength();
+
+	// The path is followed backwards from the goal, so each cell is written to its place from the end
+	PointType point = this->goal;
+
+	for (size_t remaining = length; remaining > 0; --remaining)
+	{
+		if ((remaining - 1) < count)
+			points[remaining - 1] = point;
+
+		point = this->getParent(point);
+	}
+
+	return (length < count) ? length : count;
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Algorithm.h"
+#include "Span.h"
+#include "StridedSpan.h"
+
+//
+// Declarations
+//
+
+template< typename Type >
+class GridRegion;
+
+// A view of a rectangle of items that belong to something else, stored row by row,
+// where the start of each row is stride items after the start of the one before.
+// Every walk over a region works out where each row starts and then steps a pointer along it,
+// so no cell needs its index worked out.
+// Use GridRegion<const Type> for a read only view.
+// Like a Span, it is only valid for as long as the items it views stay where they are.
+template< typename Type >
+class GridRegion
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = size_t;
+	using DimensionType = size_t;
+
+	// Visits the cells row by row.
+	// Stops at the end of the last row instead of stepping on to the next,
+	// so it never points more than one item past the last.
+	class Iterator
+	{
+	private:
+		ValueType * item;
+		ValueType * rowEnd;
+		DimensionType width;
+		SizeType stride;
+		DimensionType rowsRemaining;
+
+	public:
+		Iterator(ValueType * item, DimensionType width, SizeType stride, DimensionType rowsRemaining) noexcept
+			: item(item), rowEnd(item + width), width(width), stride(stride), rowsRemaining(rowsRemaining)
+		{
+		}
+
+		ValueType & operator *() const noexcept
+		{
+			return *this->item;
+		}
+
+		ValueType * operator ->() const noexcept
+		{
+			return this->item;
+		}
+
+		Iterator & operator ++() noexcept
+		{
+			++this->item;
+
+			if ((this->item == this->rowEnd) && (this->rowsRemaining > 1))
+			{
+				this->rowEnd += this->stride;
+				this->item = (this->rowEnd - this->width);
+				--this->rowsRemaining;
+			}
+
+			return *this;
+		}
+
+		Iterator operator ++(int) noexcept
+		{
+			const Iterator result = *this;
+			++*this;
+			return result;
+		}
+
+		bool operator ==(const Iterator & other) const noexcept
+		{
+			return (this->item == other.item);
+		}
+
+		bool operator !=(const Iterator & other) const noexcept
+		{
+			return (this->item != other.item);
+		}
+	};
+
+	using ConstIterator = Iterator;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	ValueType * data = nullptr;
+	DimensionType width = 0;
+	DimensionType height = 0;
+	SizeType stride = 0;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(1)
+	constexpr GridRegion() noexcept = default;
+
+	// O(1)
+	// data is the top left cell
+	constexpr GridRegion(ValueType * data, DimensionType width, DimensionType height, SizeType stride) noexcept
+		: data(data), width(width), height(height), stride(stride)
+	{
+	}
+
+	// O(1)
+	// Converts a GridRegion<Type> to a GridRegion<const Type>
+	template< typename Other, typename = decltype(stdlib::declval<ValueType * &>() = stdlib::declval<Other *>()) >
+	constexpr GridRegion(const GridRegion<Other> & other) noexcept
+		: data(other.getData()), width(other.getWidth()), height(other.getHeight()), stride(other.getStride())
+	{
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return ((this->width == 0) || (this->height == 0));
+	}
+
+	// O(1)
+	constexpr DimensionType getWidth() const noexcept
+	{
+		return this->width;
+	}
+
+	// O(1)
+	constexpr DimensionType getHeight() const noexcept
+	{
+		return this->height;
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return (this->width * this->height);
+	}
+
+	// O(1)
+	// The top left cell
+	constexpr ValueType * getData() const noexcept
+	{
+		return this->data;
+	}
+
+	// O(1)
+	Iterator begin() const noexcept
+	{
+		return this->isEmpty() ? Iterator(this->data, 0, this->stride, 0) : Iterator(this->data, this->width, this->stride, this->height);
+	}
+
+	// O(1)
+	Iterator end() const noexcept
+	{
+		return this->isEmpty() ? Iterator(this->data, 0, this->stride, 0) : Iterator(this->data + ((this->height - 1) * this->stride) + this->width, 0, this->stride, 0);
+	}
+
+	// O(N)
+	void fill(const ValueType & value) const;
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	// The distance in items from the start of one row to the start of the next
+	constexpr SizeType getStride() const noexcept
+	{
+		return this->stride;
+	}
+
+	// O(1)
+	constexpr ValueType & getItem(DimensionType x, DimensionType y) const
+	{
+		return this->data[(y * this->stride) + x];
+	}
+
+	// O(1)
+	// The width cells of row y
+	constexpr Span<ValueType> getRow(DimensionType y) const noexcept
+	{
+		return Span<ValueType>(this->data + (y * this->stride), this->width);
+	}
+
+	// O(1)
+	// The height cells of column x
+	constexpr StridedSpan<ValueType> getColumn(DimensionType x) const noexcept
+	{
+		return StridedSpan<ValueType>(this->data + x, this->height, this->stride);
+	}
+
+	// O(1)
+	// Up to width by height cells with (x, y) at the top left, cut short at the edges of this region
+	constexpr GridRegion getRegion(DimensionType x, DimensionType y, DimensionType width, DimensionType height) const noexcept
+	{
+		return ((x >= this->width) || (y >= this->height)) ? GridRegion(this->data, 0, 0, this->stride) :
+			GridRegion(this->data + (y * this->stride) + x,
+				(width < (this->width - x)) ? width : (this->width - x),
+				(height < (this->height - y)) ? height : (this->height - y),
+				this->stride);
+	}
+
+	// O(N)
+	// Copies as much of source as fits, with source's top left cell going to this region's top left cell.
+	// The two regions may overlap if they view the same items with the same stride.
+	void copyFrom(const GridRegion<const ValueType> & source) const;
+
+	// O(N)
+	// Calls function on each cell, row by row
+	template< typename Function >
+	void forEach(Function function) const;
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< typename Type >
+void GridRegion<Type>::fill(const ValueType & value) const
+{
+	for (DimensionType y = 0; y < this->height; ++y)
+	{
+		ValueType * const row = (this->data + (y * this->stride));
+		stdlib::fill(row, row + this->width, value);
+	}
+}
+
+// O(N)
+template< typename Type >
+void GridRegion<Type>::copyFrom(const GridRegion<const ValueType> & source) const
+{
+	const DimensionType width = (source.getWidth() < this->width) ? source.getWidth() : this->width;
+	const DimensionType height = (source.getHeight() < this->height) ? source.getHeight() : this->height;
+
+	if ((width == 0) || (height == 0))
+		return;
+
+	const SizeType sourceStride = source.getStride();
+
+	// Every target cell is the same distance from its source cell,
+	// so an overlapping copy is safe if it goes in the opposite direction to that distance
+	if (this->data > source.getData())
+	{
+		for (DimensionType y = height; y > 0; --y)
+		{
+			const ValueType * const sourceRow = (source.getData() + ((y - 1) * sourceStride));
+			ValueType * const targetRow = (this->data + ((y - 1) * this->stride));
+			stdlib::copy_backward(sourceRow, sourceRow + width, targetRow + width);
+		}
+	}
+	else
+	{
+		for (DimensionType y = 0; y < height; ++y)
+		{
+			const ValueType * const sourceRow = (source.getData() + (y * sourceStride));
+			ValueType * const targetRow = (this->data + (y * this->stride));
+			stdlib::copy(sourceRow, sourceRow + width, targetRow);
+		}
+	}
+}
+
+// O(N)
+template< typename Type >
+template< typename Function >
+void GridRegion<Type>::forEach(Function function) const
+{
+	for (DimensionType y = 0; y < this->height; ++y)
+	{
+		ValueType * const row = (this->data + (y * this->stride));
+
+		for (ValueType * item = row; item != (row + this->width); ++item)
+			function(*item);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,504 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Updates every cell of a Grid from the 3x3 block of cells around it,
+// as cellular automata and most simulations on a grid do.
+// The old cells are read from one grid and the new cells written to another,
+// and DoubleBufferedGrid swaps which of the two is current instead of copying.
+// Cells outside the grid read as an edge value, which is dealt with once per row
+// rather than checked for every cell.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Grid.h"
+
+//
+// Declarations
+//
+
+template< typename Type >
+struct StencilWindow;
+
+template< uint16_t birthCounts, uint16_t survivalCounts >
+struct LifeLikeRule;
+
+template< typename GridType >
+class DoubleBufferedGrid;
+
+//
+// StencilWindow
+//
+
+// The 3x3 block of cells around the cell being updated, which is what a rule is given
+template< typename Type >
+struct StencilWindow
+{
+	// cells[y][x], with the cell being updated at cells[1][1]
+	Type cells[3][3];
+
+	// O(1)
+	const Type & getCentre() const noexcept
+	{
+		return this->cells[1][1];
+	}
+
+	// O(1)
+	// offsetX and offsetY go from -1 to 1
+	const Type & getItem(int8_t offsetX, int8_t offsetY) const noexcept
+	{
+		return this->cells[offsetY + 1][offsetX + 1];
+	}
+
+	// O(1)
+	// The number of the eight surrounding cells that are equal to value
+	uint8_t countNeighbours(const Type & value) const
+	{
+		uint8_t count = 0;
+
+		for (uint8_t y = 0; y < 3; ++y)
+			for (uint8_t x = 0; x < 3; ++x)
+				if (((x != 1) || (y != 1)) && (this->cells[y][x] == value))
+					++count;
+
+		return count;
+	}
+};
+
+//
+// LifeLikeRule
+//
+
+// A rule in the style of Conway's Game of Life.
+// Bit N of birthCounts means a dead cell with N live neighbours comes alive,
+// and bit N of survivalCounts means a live cell with N live neighbours stays alive.
+// A cell is alive if it doesn't equal a value initialised Type.
+// On a Grid<bool>, applyStencil works on whole words of cells at once.
+template< uint16_t birthCounts, uint16_t survivalCounts >
+struct LifeLikeRule
+{
+	constexpr static const uint16_t BirthCounts = birthCounts;
+	constexpr static const uint16_t SurvivalCounts = survivalCounts;
+
+	template< typename Type >
+	Type operator()(const StencilWindow<Type> & window) const
+	{
+		const bool alive = !(window.getCentre() == Type());
+
+		// Counting all nine and then taking off the centre keeps the loop free of branches
+		uint8_t count = 0;
+
+		for (uint8_t y = 0; y < 3; ++y)
+			for (uint8_t x = 0; x < 3; ++x)
+				count += !(window.cells[y][x] == Type());
+
+		count = static_cast<uint8_t>(count - (alive ? 1 : 0));
+
+		const uint16_t counts = alive ? survivalCounts : birthCounts;
+
+		return static_cast<Type>(((counts >> count) & 1) != 0);
+	}
+};
+
+// B3/S23
+using ConwayLifeRule = LifeLikeRule<(1 << 3), ((1 << 2) | (1 << 3))>;
+
+//
+// details
+//
+
+namespace details
+{
+	// O(W)
+	// Updates row y, where hasAbove and hasBelow say whether the rows either side are inside the grid.
+	// The window slides along the row, so each step reads just the three cells of its new column.
+	template< bool hasAbove, bool hasBelow, typename SourceType, typename TargetType, typename Rule >
+	void applyStencilRow(const SourceType & source, TargetType & target, Rule & rule, const typename SourceType::ValueType & edgeValue, typename SourceType::DimensionType y)
+	{
+		using ValueType = typename SourceType::ValueType;
+		using IndexType = typename SourceType::IndexType;
+		using DimensionType = typename SourceType::DimensionType;
+
+		IndexType index = SourceType::getIndex(0, y);
+		IndexType above = hasAbove ? SourceType::stepUp(index) : index;
+		IndexType below = hasBelow ? SourceType::stepDown(index) : index;
+
+		StencilWindow<ValueType> window;
+
+		for (uint8_t row = 0; row < 3; ++row)
+			window.cells[row][0] = edgeValue;
+
+		window.cells[0][1] = hasAbove ? source[above] : edgeValue;
+		window.cells[1][1] = source[index];
+		window.cells[2][1] = hasBelow ? source[below] : edgeValue;
+
+		for (DimensionType x = 1; x < SourceType::Width; ++x)
+		{
+			const IndexType next = SourceType::stepRight(index);
+
+			if (hasAbove)
+				above = SourceType::stepRight(above);
+
+			if (hasBelow)
+				below = SourceType::stepRight(below);
+
+			window.cells[0][2] = hasAbove ? source[above] : edgeValue;
+			window.cells[1][2] = source[next];
+			window.cells[2][2] = hasBelow ? source[below] : edgeValue;
+
+			target[index] = rule(static_cast<const StencilWindow<ValueType> &>(window));
+
+			for (uint8_t row = 0; row < 3; ++row)
+			{
+				window.cells[row][0] = window.cells[row][1];
+				window.cells[row][1] = window.cells[row][2];
+			}
+
+			index = next;
+		}
+
+		// The last column is the only one whose right hand neighbours are outside
+		for (uint8_t row = 0; row < 3; ++row)
+			window.cells[row][2] = edgeValue;
+
+		target[index] = rule(static_cast<const StencilWindow<ValueType> &>(window));
+	}
+
+	// O(1)
+	// The bitsPerWord bits starting at bit position of words, with any past the end clear
+	template< typename Word >
+	Word readBitWord(const Word * words, uintmax_t wordCount, uintmax_t position) noexcept
+	{
+		constexpr uintmax_t bitsPerWord = (sizeof(Word) * 8);
+
+		const uintmax_t wordIndex = (position / bitsPerWord);
+		const uint8_t shift = static_cast<uint8_t>(position % bitsPerWord);
+
+		const Word low = static_cast<Word>(words[wordIndex] >> shift);
+
+		if ((shift == 0) || ((wordIndex + 1) >= wordCount))
+			return low;
+
+		return static_cast<Word>(low | static_cast<Word>(words[wordIndex + 1] << (bitsPerWord - shift)));
+	}
+
+	// O(1)
+	// Overwrites the count bits starting at bit position of words with the low count bits of value
+	template< typename Word >
+	void writeBitWord(Word * words, uintmax_t position, uint8_t count, Word value) noexcept
+	{
+		constexpr uintmax_t bitsPerWord = (sizeof(Word) * 8);
+
+		const uintmax_t wordIndex = (position / bitsPerWord);
+		const uint8_t shift = static_cast<uint8_t>(position % bitsPerWord);
+
+		const Word mask = (count >= bitsPerWord) ? static_cast<Word>(~static_cast<Word>(0)) : static_cast<Word>((static_cast<Word>(1) << count) - 1);
+		const Word bits = static_cast<Word>(value & mask);
+
+		words[wordIndex] = static_cast<Word>((words[wordIndex] & static_cast<Word>(~static_cast<Word>(mask << shift))) | static_cast<Word>(bits << shift));
+
+		if ((shift != 0) && ((shift + count) > bitsPerWord))
+		{
+			const uint8_t spill = static_cast<uint8_t>(bitsPerWord - shift);
+			words[wordIndex + 1] = static_cast<Word>((words[wordIndex + 1] & static_cast<Word>(~static_cast<Word>(mask >> spill))) | static_cast<Word>(bits >> spill));
+		}
+	}
+
+	// O(W)
+	// Lines row y of a packed grid up in a buffer of words, starting at bit 0,
+	// with the bits past the end of the row set to padding
+	template< uintmax_t width, typename Word >
+	void readBitRow(const Word * words, uintmax_t wordCount, uintmax_t y, Word * row, Word padding) noexcept
+	{
+		constexpr uintmax_t bitsPerWord = (sizeof(Word) * 8);
+		constexpr uintmax_t rowWordCount = ((width + bitsPerWord - 1) / bitsPerWord);
+		constexpr uintmax_t lastWordBits = (width - ((rowWordCount - 1) * bitsPerWord));
+
+		for (uintmax_t index = 0; index < rowWordCount; ++index)
+			row[index] = readBitWord(words, wordCount, (y * width) + (index * bitsPerWord));
+
+		if (lastWordBits < bitsPerWord)
+		{
+			const Word mask = static_cast<Word>((static_cast<Word>(1) << (lastWordBits % bitsPerWord)) - 1);
+			row[rowWordCount - 1] = static_cast<Word>((row[rowWordCount - 1] & mask) | padding);
+		}
+	}
+
+	// Counts up to 15 per bit, one bit of the count in each word,
+	// so every bit position of a word is counted at once
+	template< typename Word >
+	struct BitCounter
+	{
+		Word bit0 = 0;
+		Word bit1 = 0;
+		Word bit2 = 0;
+		Word bit3 = 0;
+
+		// O(1)
+		void add(Word word) noexcept
+		{
+			const Word carry0 = static_cast<Word>(this->bit0 & word);
+			this->bit0 ^= word;
+
+			const Word carry1 = static_cast<Word>(this->bit1 & carry0);
+			this->bit1 ^= carry0;
+
+			const Word carry2 = static_cast<Word>(this->bit2 & carry1);
+			this->bit2 ^= carry1;
+
+			this->bit3 |= carry2;
+		}
+
+		// O(1)
+		// The bits whose count is count
+		Word getMatches(uint8_t count) const noexcept
+		{
+			return static_cast<Word>(
+				(((count & 1) != 0) ? this->bit0 : static_cast<Word>(~this->bit0)) &
+				(((count & 2) != 0) ? this->bit1 : static_cast<Word>(~this->bit1)) &
+				(((count & 4) != 0) ? this->bit2 : static_cast<Word>(~this->bit2)) &
+				(((count & 8) != 0) ? this->bit3 : static_cast<Word>(~this->bit3)));
+		}
+	};
+
+	// O(1)
+	// Adds the cells either side of each cell of word index of row,
+	// and the cells of the word itself if the row is above or below the one being updated
+	template< uintmax_t rowWordCount, bool includeCentre, typename Word >
+	void addRowNeighbours(BitCounter<Word> & counter, const Word * row, uintmax_t index, Word edgeWord) noexcept
+	{
+		constexpr uintmax_t bitsPerWord = (sizeof(Word) * 8);
+
+		const Word word = row[index];
+		const Word previous = (index > 0) ? row[index - 1] : edgeWord;
+		const Word next = ((index + 1) < rowWordCount) ? row[index + 1] : edgeWord;
+
+		// Bit x of the first is cell x - 1, and bit x of the second is cell x + 1
+		counter.add(static_cast<Word>((word << 1) | (previous >> (bitsPerWord - 1))));
+		counter.add(static_cast<Word>((word >> 1) | (next << (bitsPerWord - 1))));
+
+		if (includeCentre)
+			counter.add(word);
+	}
+
+	// O(1)
+	// The counts are constants, so the loop reduces to the handful of counts the rule uses
+	template< uint16_t birthCounts, uint16_t survivalCounts, typename Word >
+	Word applyLifeLikeRule(const BitCounter<Word> & counter, Word alive) noexcept
+	{
+		Word result = 0;
+
+		for (uint8_t count = 0; count <= 8; ++count)
+		{
+			const bool born = (((birthCounts >> count) & 1) != 0);
+			const bool survives = (((survivalCounts >> count) & 1) != 0);
+
+			if (!born && !survives)
+				continue;
+
+			const Word cells = born ? (survives ? static_cast<Word>(~static_cast<Word>(0)) : static_cast<Word>(~alive)) : alive;
+			result |= static_cast<Word>(counter.getMatches(count) & cells);
+		}
+
+		return result;
+	}
+}
+
+//
+// applyStencil
+//
+
+// O(N)
+// Sets each cell of target to rule(window), where window is the 3x3 block around the same cell of source.
+// Cells outside the grid read as edgeValue.
+// source and target must be different grids, but may hold different types.
+template< typename Type, typename Result, uintmax_t width, uintmax_t height, typename Layout, typename Rule >
+void applyStencil(const Grid<Type, width, height, Layout> & source, Grid<Result, width, height, Layout> & target, Rule rule, const Type & edgeValue = Type())
+{
+	static_assert(!stdlib::is_same<Type, bool>::value, "A Grid<bool> can only be updated with a LifeLikeRule");
+
+	using SourceType = Grid<Type, width, height, Layout>;
+	using DimensionType = typename SourceType::DimensionType;
+
+	if (height == 1)
+	{
+		details::applyStencilRow<false, false>(source, target, rule, edgeValue, 0);
+		return;
+	}
+
+	details::applyStencilRow<false, true>(source, target, rule, edgeValue, 0);
+
+	for (DimensionType y = 1; y < (height - 1); ++y)
+		details::applyStencilRow<true, true>(source, target, rule, edgeValue, y);
+
+	details::applyStencilRow<true, false>(source, target, rule, edgeValue, static_cast<DimensionType>(height - 1));
+}
+
+// O(N)
+// Works a word of cells at a time: each row is lined up in a buffer of words,
+// the eight neighbours of every cell in a word are added up as bit counts,
+// and the rule is applied to the whole word.
+// Unlike the searches in Algorithm.h there is no SSE2 or AVX2 version:
+// rows have to be realigned into the buffers anyway, because they don't start on word boundaries,
+// and a screen sized row is only a couple of words, so wider registers would mostly sit half empty.
+// Plain words keep the one version working the same on AVR.
+// Cells outside the grid read as edgeValue.
+// source and target must be different grids.
+template< uintmax_t width, uintmax_t height, uint16_t birthCounts, uint16_t survivalCounts >
+void applyStencil(const Grid<bool, width, height> & source, Grid<bool, width, height> & target, LifeLikeRule<birthCounts, survivalCounts>, bool edgeValue = false)
+{
+	using GridType = Grid<bool, width, height>;
+	using WordType = typename GridType::WordType;
+
+	constexpr uintmax_t bitsPerWord = (sizeof(WordType) * 8);
+	constexpr uintmax_t rowWordCount = ((width + bitsPerWord - 1) / bitsPerWord);
+	constexpr uint8_t lastWordBits = static_cast<uint8_t>(width - ((rowWordCount - 1) * bitsPerWord));
+
+	const WordType edgeWord = edgeValue ? static_cast<WordType>(~static_cast<WordType>(0)) : static_cast<WordType>(0);
+
+	// Bits past the end of the row are the right hand neighbours of its last cell
+	const WordType lastWordPadding = (lastWordBits >= bitsPerWord) ? static_cast<WordType>(0) : static_cast<WordType>(edgeWord & static_cast<WordType>(~static_cast<WordType>((static_cast<WordType>(1) << lastWordBits) - 1)));
+
+	const WordType * const sourceWords = source.getWords();
+	WordType * const targetWords = target.getWords();
+
+	// Three row buffers, rotated as the rows move down
+	WordType rows[3][rowWordCount];
+	WordType * above = rows[0];
+	WordType * current = rows[1];
+	WordType * below = rows[2];
+
+	for (uintmax_t index = 0; index < rowWordCount; ++index)
+		above[index] = edgeWord;
+
+	details::readBitRow<width>(sourceWords, GridType::WordCount, 0, current, lastWordPadding);
+
+	for (uintmax_t y = 0; y < height; ++y)
+	{
+		if ((y + 1) < height)
+			details::readBitRow<width>(sourceWords, GridType::WordCount, (y + 1), below, lastWordPadding);
+		else
+			for (uintmax_t index = 0; index < rowWordCount; ++index)
+				below[index] = edgeWord;
+
+		for (uintmax_t index = 0; index < rowWordCount; ++index)
+		{
+			details::BitCounter<WordType> counter;
+
+			details::addRowNeighbours<rowWordCount, true>(counter, above, index, edgeWord);
+			details::addRowNeighbours<rowWordCount, false>(counter, current, index, edgeWord);
+			details::addRowNeighbours<rowWordCount, true>(counter, below, index, edgeWord);
+
+			const WordType result = details::applyLifeLikeRule<birthCounts, survivalCounts>(counter, current[index]);
+			const uint8_t count = ((index + 1) < rowWordCount) ? static_cast<uint8_t>(bitsPerWord) : lastWordBits;
+
+			details::writeBitWord(targetWords, (y * width) + (index * bitsPerWord), count, result);
+		}
+
+		WordType * const spare = above;
+		above = current;
+		current = below;
+		below = spare;
+	}
+}
+
+//
+// DoubleBufferedGrid
+//
+
+// Two grids, one holding the current cells and the other the cells being worked out.
+// Each step writes the next cells over the old ones and then swaps which grid is current,
+// so nothing is ever copied.
+template< typename GridType >
+class DoubleBufferedGrid
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = typename GridType::ValueType;
+	using DimensionType = typename GridType::DimensionType;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	GridType grids[2];
+	uint8_t currentIndex = 0;
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	GridType & getCurrent() noexcept
+	{
+		return this->grids[this->currentIndex];
+	}
+
+	// O(1)
+	const GridType & getCurrent() const noexcept
+	{
+		return this->grids[this->currentIndex];
+	}
+
+	// O(1)
+	// The grid the next step will write to
+	GridType & getNext() noexcept
+	{
+		return this->grids[this->currentIndex ^ 1];
+	}
+
+	// O(1)
+	const GridType & getNext() const noexcept
+	{
+		return this->grids[this->currentIndex ^ 1];
+	}
+
+	// O(1)
+	// Makes the next grid current, for when it has been written some other way
+	void flip() noexcept
+	{
+		this->currentIndex ^= 1;
+	}
+
+	// O(N)
+	// Applies rule to every cell, with cells outside the grid reading as a value initialised ValueType
+	template< typename Rule >
+	void step(Rule rule)
+	{
+		applyStencil(this->getCurrent(), this->getNext(), rule);
+		this->flip();
+	}
+
+	// O(N)
+	// Applies rule to every cell, with cells outside the grid reading as edgeValue
+	template< typename Rule >
+	void step(Rule rule, const ValueType & edgeValue)
+	{
+		applyStencil(this->getCurrent(), this->getNext(), rule, edgeValue);
+		this->flip();
+	}
+};
\ No newline at end of file
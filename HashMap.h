@@ -0,0 +1,365 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Functional.h"
+#include "HashTable.h"
+
+//
+// Declarations
+//
+
+template< typename Key, typename Value >
+class HashMapEntry;
+
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash = stdlib::hash<Key> >
+class HashMap;
+
+//
+// HashMapEntry
+//
+
+// A key and its value.
+// The key can't be changed, because the entry's slot depends on it.
+template< typename Key, typename Value >
+class HashMapEntry
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using KeyType = Key;
+	using ValueType = Value;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	KeyType key;
+	ValueType value;
+
+public:
+
+	//
+	// Constructors and Assignment
+	//
+
+	// O(1)
+	template< typename ... Arguments >
+	HashMapEntry(const KeyType & key, Arguments && ... arguments)
+		: key(key), value(stdlib::forward<Arguments>(arguments)...)
+	{
+	}
+
+	HashMapEntry(const HashMapEntry & other) = default;
+	HashMapEntry(HashMapEntry && other) = default;
+
+	HashMapEntry & operator =(const HashMapEntry & other) = delete;
+	HashMapEntry & operator =(HashMapEntry && other) = delete;
+
+public:
+
+	//
+	// Member Functions
+	//
+
+	// O(1)
+	const KeyType & getKey() const noexcept
+	{
+		return this->key;
+	}
+
+	// O(1)
+	ValueType & getValue() noexcept
+	{
+		return this->value;
+	}
+
+	// O(1)
+	const ValueType & getValue() const noexcept
+	{
+		return this->value;
+	}
+};
+
+namespace details
+{
+	template< typename Key, typename Value >
+	struct HashMapKeyOf
+	{
+		using KeyType = Key;
+
+		static const KeyType & getKey(const HashMapEntry<Key, Value> & entry) noexcept
+		{
+			return entry.getKey();
+		}
+	};
+}
+
+//
+// HashMap
+//
+
+// Maps up to capactiy keys to values, with O(1) lookups on average.
+// Everything is stored inline, in a table with a power of two number of slots
+// and at least a fifth of them spare, so the size is fixed at compile time.
+// Hash is any type whose operator() turns a key into a size_t,
+// keys must also be comparable with ==.
+// Adding or removing an entry may move others, which invalidates pointers and iterators.
+template< typename Key, typename Value, uintmax_t capactiyValue, typename Hash >
+class HashMap
+{
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using TableType = details::HashTable<HashMapEntry<Key, Value>, details::HashMapKeyOf<Key, Value>, capactiyValue, Hash>;
+
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using KeyType = Key;
+	using ValueType = Value;
+	using EntryType = HashMapEntry<Key, Value>;
+	using HashType = Hash;
+	using SizeType = typename TableType::SizeType;
+	using Iterator = typename TableType::Iterator;
+	using ConstIterator = typename TableType::ConstIterator;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = TableType::capactiy;
+	constexpr static const uintmax_t SlotCount = TableType::SlotCount;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	TableType table;
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return this->table.isEmpty();
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return this->table.isFull();
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->table.getCount();
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(N)
+	// Visits every entry, in no particular order
+	Iterator begin() noexcept
+	{
+		return this->table.begin();
+	}
+
+	// O(N)
+	ConstIterator begin() const noexcept
+	{
+		return this->table.begin();
+	}
+
+	// O(1)
+	Iterator end() noexcept
+	{
+		return this->table.end();
+	}
+
+	// O(1)
+	ConstIterator end() const noexcept
+	{
+		return this->table.end();
+	}
+
+	// O(N)
+	void clear()
+	{
+		this->table.clear();
+	}
+
+	// O(1) on average
+	bool contains(const KeyType & key) const
+	{
+		return (this->table.findSlot(key) != TableType::InvalidSlot);
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1) on average
+	// The value for key, or nullptr if there is none
+	ValueType * find(const KeyType & key);
+
+	// O(1) on average
+	const ValueType * find(const KeyType & key) const;
+
+	// O(1) on average
+	// Does nothing if key is already present.
+	// Returns false if nothing was added, because key was present or the map is full.
+	bool add(const KeyType & key, const ValueType & value)
+	{
+		return this->emplace(key, value);
+	}
+
+	// O(1) on average
+	bool add(const KeyType & key, ValueType && value)
+	{
+		return this->emplace(key, stdlib::move(value));
+	}
+
+	// O(1) on average
+	// The value is constructed from arguments
+	template< typename ... Arguments >
+	bool emplace(const KeyType & key, Arguments && ... arguments)
+	{
+		bool added;
+		this->table.emplace(key, added, key, stdlib::forward<Arguments>(arguments)...);
+		return added;
+	}
+
+	// O(1) on average
+	// Adds key or replaces its value, returns false only if key was missing and the map is full
+	bool set(const KeyType & key, const ValueType & value);
+
+	// O(1) on average
+	bool set(const KeyType & key, ValueType && value);
+
+	// O(1) on average
+	// The value for key, adding a value initialised one if there was none.
+	// Returns nullptr if key was missing and the map is full.
+	ValueType * findOrAdd(const KeyType & key);
+
+	// O(1) on average
+	bool remove(const KeyType & key)
+	{
+		return this->table.remove(key);
+	}
+};
+
+//
+// Definition
+//
+
+// O(1) on average
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash >
+auto HashMap<Key, Value, capactiy, Hash>::find(const KeyType & key) -> ValueType *
+{
+	const auto slot = this->table.findSlot(key);
+
+	if (slot == TableType::InvalidSlot)
+		return nullptr;
+
+	return &this->table.getEntry(static_cast<typename TableType::SlotType>(slot)).getValue();
+}
+
+// O(1) on average
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash >
+auto HashMap<Key, Value, capactiy, Hash>::find(const KeyType & key) const -> const ValueType *
+{
+	const auto slot = this->table.findSlot(key);
+
+	if (slot == TableType::InvalidSlot)
+		return nullptr;
+
+	return &this->table.getEntry(static_cast<typename TableType::SlotType>(slot)).getValue();
+}
+
+// O(1) on average
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash >
+bool HashMap<Key, Value, capactiy, Hash>::set(const KeyType & key, const ValueType & value)
+{
+	bool added;
+	const auto slot = this->table.emplace(key, added, key, value);
+
+	if (slot == TableType::InvalidSlot)
+		return false;
+
+	if (!added)
+		this->table.getEntry(static_cast<typename TableType::SlotType>(slot)).getValue() = value;
+
+	return true;
+}
+
+// O(1) on average
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash >
+bool HashMap<Key, Value, capactiy, Hash>::set(const KeyType & key, ValueType && value)
+{
+	bool added;
+	const auto slot = this->table.emplace(key, added, key, stdlib::move(value));
+
+	if (slot == TableType::InvalidSlot)
+		return false;
+
+	// value is only moved from if it was used to build a new entry
+	if (!added)
+		this->table.getEntry(static_cast<typename TableType::SlotType>(slot)).getValue() = stdlib::move(value);
+
+	return true;
+}
+
+// O(1) on average
+template< typename Key, typename Value, uintmax_t capactiy, typename Hash >
+auto HashMap<Key, Value, capactiy, Hash>::findOrAdd(const KeyType & key) -> ValueType *
+{
+	bool added;
+	const auto slot = this->table.emplace(key, added, key);
+
+	if (slot == TableType::InvalidSlot)
+		return nullptr;
+
+	return &this->table.getEntry(static_cast<typename TableType::SlotType>(slot)).getValue();
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Functional.h"
+#include "HashTable.h"
+
+//
+// Declarations
+//
+
+template< typename Key, uintmax_t capactiy, typename Hash = stdlib::hash<Key> >
+class HashSet;
+
+namespace details
+{
+	template< typename Key >
+	struct HashSetKeyOf
+	{
+		using KeyType = Key;
+
+		static const KeyType & getKey(const KeyType & key) noexcept
+		{
+			return key;
+		}
+	};
+}
+
+// Up to capactiy distinct keys, with O(1) lookups on average.
+// Stored the same way as a HashMap, but with no values.
+// Adding or removing a key may move others, which invalidates iterators.
+template< typename Key, uintmax_t capactiyValue, typename Hash >
+class HashSet
+{
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using TableType = details::HashTable<Key, details::HashSetKeyOf<Key>, capactiyValue, Hash>;
+
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using KeyType = Key;
+	using ValueType = Key;
+	using HashType = Hash;
+	using SizeType = typename TableType::SizeType;
+	using ConstIterator = typename TableType::ConstIterator;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = TableType::capactiy;
+	constexpr static const uintmax_t SlotCount = TableType::SlotCount;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	TableType table;
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return this->table.isEmpty();
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return this->table.isFull();
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->table.getCount();
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(N)
+	// Visits every key, in no particular order.
+	// Keys can't be changed in place, because their slots depend on them.
+	ConstIterator begin() const noexcept
+	{
+		return this->table.begin();
+	}
+
+	// O(1)
+	ConstIterator end() const noexcept
+	{
+		return this->table.end();
+	}
+
+	// O(N)
+	void clear()
+	{
+		this->table.clear();
+	}
+
+	// O(1) on average
+	bool contains(const KeyType & key) const
+	{
+		return (this->table.findSlot(key) != TableType::InvalidSlot);
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1) on average
+	// Returns false if nothing was added, because key was present or the set is full
+	bool add(const KeyType & key)
+	{
+		bool added;
+		this->table.emplace(key, added, key);
+		return added;
+	}
+
+	// O(1) on average
+	bool add(KeyType && key)
+	{
+		bool added;
+		this->table.emplace(key, added, stdlib::move(key));
+		return added;
+	}
+
+	// O(1) on average
+	bool remove(const KeyType & key)
+	{
+		return this->table.remove(key);
+	}
+};
\ No newline at end of file
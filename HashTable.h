@@ -0,0 +1,513 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// The open addressing table shared by HashMap and HashSet
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Algorithm.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
+
+namespace details
+{
+	//
+	// Table Sizing
+	//
+
+	// At least a fifth of the slots are always free, which keeps probe runs short,
+	// and the count is a power of two so a slot index is just the top bits of a product
+	constexpr uintmax_t hashSlotCount(uintmax_t capacity)
+	{
+		return nextPowerOfTwo(capacity + ((capacity + 3) / 4));
+	}
+
+	// 2^N divided by the golden ratio, where N is the width of size_t.
+	// Multiplying by it mixes every bit of a hash into the top bits,
+	// so hashes that differ only in their low bits still land far apart.
+	template< uint8_t size = sizeof(size_t) >
+	struct FibonacciMultiplier;
+
+	template<>
+	struct FibonacciMultiplier<2>
+	{
+		constexpr static const size_t value = static_cast<size_t>(40503u);
+	};
+
+	template<>
+	struct FibonacciMultiplier<4>
+	{
+		constexpr static const size_t value = static_cast<size_t>(2654435769u);
+	};
+
+	template<>
+	struct FibonacciMultiplier<8>
+	{
+		constexpr static const size_t value = static_cast<size_t>(11400714819323198485ull);
+	};
+
+	//
+	// HashTable
+	//
+
+	// Robin Hood hashing with linear probing.
+	// An entry that is further from its home slot than the entry in its way takes that slot,
+	// so every run of entries is ordered by home slot and a failed lookup can stop early.
+	// Removing an entry shifts the rest of its run back a slot instead of leaving a tombstone,
+	// so lookups never slow down as entries come and go.
+	// KeyOf must provide KeyType and a static getKey(const Entry &).
+	template< typename Entry, typename KeyOf, uintmax_t capactiyValue, typename Hash >
+	class HashTable
+	{
+	public:
+
+		//
+		// Constraints
+		//
+
+		static_assert(capactiyValue > 0, "Attempt to create a hash table with a capacity less than 1");
+
+		//
+		// Type Aliases
+		//
+
+		using EntryType = Entry;
+		using KeyType = typename KeyOf::KeyType;
+		using HashType = Hash;
+		using SizeType = SmallestUnsignedType<capactiyValue>;
+		using SlotType = SmallestUnsignedType<hashSlotCount(capactiyValue)>;
+		using SlotOfType = SmallestSignedType<hashSlotCount(capactiyValue) - 1>;
+
+		//
+		// Constants
+		//
+
+		constexpr static const SizeType capactiy = capactiyValue;
+		constexpr static const SlotType SlotCount = hashSlotCount(capactiyValue);
+		constexpr static const SlotOfType InvalidSlot = -1;
+
+		static_assert(floorLog2(hashSlotCount(capactiyValue)) < (sizeof(size_t) * 8), "Hash table capacity is too large for size_t");
+
+		//
+		// Iterators
+		//
+
+		// Visits the occupied slots in slot order
+		template< typename Table, typename Value >
+		class BasicIterator
+		{
+		private:
+			Table * table;
+			SlotType slot;
+
+			void skipEmpty() noexcept
+			{
+				while ((this->slot < SlotCount) && (this->table->probes[this->slot] == 0))
+					++this->slot;
+			}
+
+		public:
+			BasicIterator(Table * table, SlotType slot) noexcept
+				: table(table), slot(slot)
+			{
+				this->skipEmpty();
+			}
+
+			Value & operator *() const noexcept
+			{
+				return this->table->entries[this->slot];
+			}
+
+			Value * operator ->() const noexcept
+			{
+				return &this->table->entries[this->slot];
+			}
+
+			BasicIterator & operator ++() noexcept
+			{
+				++this->slot;
+				this->skipEmpty();
+				return *this;
+			}
+
+			BasicIterator operator ++(int) noexcept
+			{
+				const BasicIterator result = *this;
+				++*this;
+				return result;
+			}
+
+			bool operator ==(const BasicIterator & other) const noexcept
+			{
+				return (this->slot == other.slot);
+			}
+
+			bool operator !=(const BasicIterator & other) const noexcept
+			{
+				return (this->slot != other.slot);
+			}
+		};
+
+		using Iterator = BasicIterator<HashTable, EntryType>;
+		using ConstIterator = BasicIterator<const HashTable, const EntryType>;
+
+	private:
+
+		//
+		// Private Type Aliases
+		//
+
+		// A stored probe never exceeds the number of entries,
+		// but a search can go one further, so searches count in SlotType
+		using ProbeType = SizeType;
+
+		//
+		// Private Constants
+		//
+
+		constexpr static const SlotType slotMask = (SlotCount - 1);
+		constexpr static const uint8_t slotShift = ((sizeof(size_t) * 8) - floorLog2(hashSlotCount(capactiyValue)));
+
+		//
+		// Member Variables
+		//
+
+		UninitialisedStorage<EntryType, SlotCount> entries;
+
+		// 0 for an empty slot, otherwise one more than the distance from the entry's home slot
+		ProbeType probes[SlotCount] = {};
+
+		SizeType count = 0;
+
+		//
+		// Private Member Functions
+		//
+
+		// O(1)
+		static SlotType getHome(const KeyType & key)
+		{
+			return static_cast<SlotType>(static_cast<size_t>(HashType()(key) * FibonacciMultiplier<>::value) >> slotShift);
+		}
+
+		// O(1)
+		static SlotType getNext(SlotType slot) noexcept
+		{
+			return static_cast<SlotType>((slot + 1) & slotMask);
+		}
+
+	public:
+
+		//
+		// Constructors, Destructor and Assignment
+		//
+
+		HashTable() = default;
+
+		// O(N)
+		HashTable(const HashTable & other);
+
+		// O(N)
+		HashTable(HashTable && other);
+
+		// O(N)
+		~HashTable()
+		{
+			this->clear();
+		}
+
+		// O(N)
+		HashTable & operator =(const HashTable & other);
+
+		// O(N)
+		HashTable & operator =(HashTable && other);
+
+	public:
+
+		//
+		// Member Functions
+		//
+
+		// O(1)
+		bool isEmpty() const noexcept
+		{
+			return (this->count == 0);
+		}
+
+		// O(1)
+		bool isFull() const noexcept
+		{
+			return (this->count == capactiy);
+		}
+
+		// O(1)
+		SizeType getCount() const noexcept
+		{
+			return this->count;
+		}
+
+		// O(1)
+		constexpr SizeType getCapacity() const noexcept
+		{
+			return capactiy;
+		}
+
+		// O(N), skips any empty slots at the start
+		Iterator begin() noexcept
+		{
+			return Iterator(this, 0);
+		}
+
+		// O(N)
+		ConstIterator begin() const noexcept
+		{
+			return ConstIterator(this, 0);
+		}
+
+		// O(1)
+		Iterator end() noexcept
+		{
+			return Iterator(this, SlotCount);
+		}
+
+		// O(1)
+		ConstIterator end() const noexcept
+		{
+			return ConstIterator(this, SlotCount);
+		}
+
+		// O(1)
+		EntryType & getEntry(SlotType slot)
+		{
+			return this->entries[slot];
+		}
+
+		// O(1)
+		const EntryType & getEntry(SlotType slot) const
+		{
+			return this->entries[slot];
+		}
+
+		// O(N)
+		void clear();
+
+		// O(1) on average
+		// The slot holding key, or InvalidSlot if there is none
+		SlotOfType findSlot(const KeyType & key) const;
+
+		// O(1) on average
+		// Returns the slot holding key, constructing an entry from arguments if there was none.
+		// added says which happened. Returns InvalidSlot if key was missing and the table is full.
+		template< typename ... Arguments >
+		SlotOfType emplace(const KeyType & key, bool & added, Arguments && ... arguments);
+
+		// O(1) on average
+		void removeSlot(SlotType slot);
+
+		// O(1) on average
+		bool remove(const KeyType & key)
+		{
+			const SlotOfType slot = this->findSlot(key);
+
+			if (slot == InvalidSlot)
+				return false;
+
+			this->removeSlot(static_cast<SlotType>(slot));
+			return true;
+		}
+	};
+
+	//
+	// Definition
+	//
+
+	// O(N)
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	HashTable<Entry, KeyOf, capactiy, Hash>::HashTable(const HashTable & other)
+	{
+		for (SlotType slot = 0; slot < SlotCount; ++slot)
+			if (other.probes[slot] != 0)
+				this->entries.construct(slot, other.entries[slot]);
+
+		stdlib::copy(&other.probes[0], &other.probes[0] + SlotCount, &this->probes[0]);
+		this->count = other.count;
+	}
+
+	// O(N)
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	HashTable<Entry, KeyOf, capactiy, Hash>::HashTable(HashTable && other)
+	{
+		for (SlotType slot = 0; slot < SlotCount; ++slot)
+			if (other.probes[slot] != 0)
+				this->entries.construct(slot, stdlib::move(other.entries[slot]));
+
+		stdlib::copy(&other.probes[0], &other.probes[0] + SlotCount, &this->probes[0]);
+		this->count = other.count;
+		other.clear();
+	}
+
+	// O(N)
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	auto HashTable<Entry, KeyOf, capactiy, Hash>::operator =(const HashTable & other) -> HashTable &
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			for (SlotType slot = 0; slot < SlotCount; ++slot)
+				if (other.probes[slot] != 0)
+					this->entries.construct(slot, other.entries[slot]);
+
+			stdlib::copy(&other.probes[0], &other.probes[0] + SlotCount, &this->probes[0]);
+			this->count = other.count;
+		}
+		return *this;
+	}
+
+	// O(N)
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	auto HashTable<Entry, KeyOf, capactiy, Hash>::operator =(HashTable && other) -> HashTable &
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			for (SlotType slot = 0; slot < SlotCount; ++slot)
+				if (other.probes[slot] != 0)
+					this->entries.construct(slot, stdlib::move(other.entries[slot]));
+
+			stdlib::copy(&other.probes[0], &other.probes[0] + SlotCount, &this->probes[0]);
+			this->count = other.count;
+			other.clear();
+		}
+		return *this;
+	}
+
+	// O(N)
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	void HashTable<Entry, KeyOf, capactiy, Hash>::clear()
+	{
+		for (SlotType slot = 0; slot < SlotCount; ++slot)
+			if (this->probes[slot] != 0)
+			{
+				this->entries.destroy(slot);
+				this->probes[slot] = 0;
+			}
+
+		this->count = 0;
+	}
+
+	// O(1) on average
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	auto HashTable<Entry, KeyOf, capactiy, Hash>::findSlot(const KeyType & key) const -> SlotOfType
+	{
+		SlotType slot = getHome(key);
+
+		// Once the entries in the way are closer to home than key would be,
+		// key would have taken one of their slots, so it can't be further on
+		for (SlotType probe = 1; this->probes[slot] >= probe; ++probe)
+		{
+			if ((this->probes[slot] == probe) && (KeyOf::getKey(this->entries[slot]) == key))
+				return static_cast<SlotOfType>(slot);
+
+			slot = getNext(slot);
+		}
+
+		return InvalidSlot;
+	}
+
+	// O(1) on average
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	template< typename ... Arguments >
+	auto HashTable<Entry, KeyOf, capactiy, Hash>::emplace(const KeyType & key, bool & added, Arguments && ... arguments) -> SlotOfType
+	{
+		added = false;
+
+		SlotType slot = getHome(key);
+		SlotType probe = 1;
+
+		for (; this->probes[slot] >= probe; ++probe)
+		{
+			if ((this->probes[slot] == probe) && (KeyOf::getKey(this->entries[slot]) == key))
+				return static_cast<SlotOfType>(slot);
+
+			slot = getNext(slot);
+		}
+
+		if (this->isFull())
+			return InvalidSlot;
+
+		if (this->probes[slot] == 0)
+		{
+			this->entries.construct(slot, stdlib::forward<Arguments>(arguments)...);
+		}
+		else
+		{
+			// Build the entry before shifting in case the arguments refer to an entry
+			EntryType entry(stdlib::forward<Arguments>(arguments)...);
+
+			// Taking this slot from a richer entry is the same as
+			// shifting the rest of the run along to the next empty slot
+			SlotType empty = getNext(slot);
+
+			while (this->probes[empty] != 0)
+				empty = getNext(empty);
+
+			while (empty != slot)
+			{
+				const SlotType previous = static_cast<SlotType>((empty - 1) & slotMask);
+
+				this->entries.construct(empty, stdlib::move(this->entries[previous]));
+				this->entries.destroy(previous);
+				this->probes[empty] = static_cast<ProbeType>(this->probes[previous] + 1);
+
+				empty = previous;
+			}
+
+			this->entries.construct(slot, stdlib::move(entry));
+		}
+
+		this->probes[slot] = static_cast<ProbeType>(probe);
+		++this->count;
+
+		added = true;
+		return static_cast<SlotOfType>(slot);
+	}
+
+	// O(1) on average
+	template< typename Entry, typename KeyOf, uintmax_t capactiy, typename Hash >
+	void HashTable<Entry, KeyOf, capactiy, Hash>::removeSlot(SlotType slot)
+	{
+		this->entries.destroy(slot);
+
+		// Pull the rest of the run back a slot, until an empty slot
+		// or an entry that is already in its home slot
+		for (SlotType next = getNext(slot); this->probes[next] > 1; next = getNext(next))
+		{
+			this->entries.construct(slot, stdlib::move(this->entries[next]));
+			this->entries.destroy(next);
+			this->probes[slot] = static_cast<ProbeType>(this->probes[next] - 1);
+
+			slot = next;
+		}
+
+		this->probes[slot] = 0;
+		--this->count;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "TypeTraits.h"
+
+//
+// Smallest Unsigned Type
+//
+
+// The smallest unsigned integer type that can represent value
+template< uintmax_t value >
+using SmallestUnsignedType =
+	stdlib::conditional_t<(value <= UINT8_MAX), uint8_t,
+	stdlib::conditional_t<(value <= UINT16_MAX), uint16_t,
+	stdlib::conditional_t<(value <= UINT32_MAX), uint32_t,
+	uint64_t>>>;
+
+//
+// Smallest Signed Type
+//
+
+// The smallest signed integer type that can represent both value and -1
+template< uintmax_t value >
+using SmallestSignedType =
+	stdlib::conditional_t<(value <= INT8_MAX), int8_t,
+	stdlib::conditional_t<(value <= INT16_MAX), int16_t,
+	stdlib::conditional_t<(value <= INT32_MAX), int32_t,
+	int64_t>>>;
+
+//
+// Powers of Two
+//
+
+namespace details
+{
+	// O(log N)
+	// The smallest power of two that is at least value
+	constexpr uintmax_t nextPowerOfTwo(uintmax_t value, uintmax_t result = 1)
+	{
+		return (result >= value) ? result : nextPowerOfTwo(value, result * 2);
+	}
+
+	// O(log N)
+	constexpr uint8_t floorLog2(uintmax_t value)
+	{
+		return (value <= 1) ? 0 : (1 + floorLog2(value / 2));
+	}
+
+	// O(1)
+	constexpr bool isPowerOfTwo(uintmax_t value)
+	{
+		return (value != 0) && ((value & (value - 1)) == 0);
+	}
+}
+
+//
+// Item Conversion
+//
+
+namespace details
+{
+	// O(1)
+	// Whether value survives being converted to To and back, sign included
+	template< typename To, typename From >
+	constexpr bool valueFits(const From & value) noexcept
+	{
+		return (static_cast<From>(static_cast<To>(value)) == value) && ((value < From()) == (static_cast<To>(value) < To()));
+	}
+
+	// O(1)
+	// Deliberately not constexpr,
+	// so reaching it while evaluating a constant expression is a compile error.
+	// The conversion is left implicit, so -Wconversion still reports it.
+	template< typename To, typename From >
+	To narrowingConversion(const From & value) noexcept
+	{
+		return value;
+	}
+
+	// O(1)
+	template< typename To, typename From >
+	constexpr To convertItem(const From & value, stdlib::true_type) noexcept
+	{
+		return valueFits<To>(value) ? static_cast<To>(value) : narrowingConversion<To>(value);
+	}
+
+	// O(1)
+	template< typename To, typename From >
+	constexpr To convertItem(const From & value, stdlib::false_type)
+	{
+		return value;
+	}
+
+	// O(1)
+	// Converts an item given to a container constructor.
+	// Numbers are checked: in a constexpr context a value that doesn't fit To fails to compile
+	// instead of silently changing, but an int literal that does fit is still accepted.
+	// Anywhere else it is converted as an implicit conversion would be.
+	// Anything that isn't a number must convert implicitly.
+	template< typename To, typename From >
+	constexpr To convertItem(const From & value)
+	{
+		return convertItem<To>(value, stdlib::bool_constant<stdlib::is_arithmetic<To>::value && stdlib::is_arithmetic<From>::value>());
+	}
+}
\ No newline at end of file
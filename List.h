@@ -16,6 +16,7 @@
 //  limitations under the License.
 //
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "Deque.h"
@@ -24,10 +25,10 @@
 // Declarations
 //
 
-template< typename Type, uint8_t capactiy, typename Container = Deque<Type, capactiy> >
+template< typename Type, uintmax_t capactiy, typename Container = Deque<Type, capactiy> >
 class List;
 
-template< typename Type, uint8_t capactiyValue, typename Container >
+template< typename Type, uintmax_t capactiyValue, typename Container >
 class List
 {
 public:
@@ -37,7 +38,6 @@ public:
 	//
 
 	//static_assert(capactiyValue > 0, "Attempt to create List with a capacity less than 1");
-	static_assert(capactiyValue < 128, "Attempt to create List with a capacity greater than 127");
 
 	//
 	// Type Aliases
@@ -48,6 +48,8 @@ public:
 	using SizeType = typename ContainerType::SizeType;
 	using IndexType = typename ContainerType::IndexType;
 	using IndexOfType = typename ContainerType::IndexOfType;
+	using Iterator = typename ContainerType::Iterator;
+	using ConstIterator = typename ContainerType::ConstIterator;
 	
 	//
 	// Constants
@@ -120,6 +122,30 @@ public:
 		return this->container[index];
 	}
 	
+	// O(1)
+	Iterator begin()
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	ConstIterator begin() const
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	Iterator end()
+	{
+		return this->container.end();
+	}
+
+	// O(1)
+	ConstIterator end() const
+	{
+		return this->container.end();
+	}
+	
 	// O(N)
 	void clear()
 	{
@@ -149,6 +175,18 @@ public:
 	{
 		return this->container.indexOfLast(item);
 	}
+
+	// O(N)
+	SizeType count(const ValueType & item) const
+	{
+		return this->container.count(item);
+	}
+
+	// O(N)
+	IndexOfType indexOfAny(const ValueType * set, size_t count) const
+	{
+		return this->container.indexOfAny(set, count);
+	}
 	
 public:
 
@@ -161,6 +199,33 @@ public:
 	{
 		return this->container.append(item);
 	}
+
+	// O(1)
+	bool add(ValueType && item)
+	{
+		return this->container.append(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments)
+	{
+		return this->container.emplaceBack(stdlib::forward<Arguments>(arguments)...);
+	}
+
+	// O(N)
+	// Adds as many items as will fit, returns the number added
+	SizeType addRange(const ValueType * source, SizeType count)
+	{
+		return this->container.appendRange(source, count);
+	}
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType addRange(const OtherContainer & container)
+	{
+		return this->container.appendRange(container);
+	}
 	
 	// O(N)
 	bool removeFirst(const ValueType & item)
@@ -180,9 +245,45 @@ public:
 		return this->container.removeAt(index);
 	}
 
+	// O(N)
+	// Like removeFirst, but fills the gap with the last item instead of shifting the rest
+	bool removeFirstUnordered(const ValueType & item)
+	{
+		return this->container.removeFirstUnordered(item);
+	}
+
+	// O(1)
+	// Like removeAt, but fills the gap with the last item instead of shifting the rest
+	bool removeAtUnordered(const IndexType & index)
+	{
+		return this->container.removeAtUnordered(index);
+	}
+
+	// O(N)
+	// Removes every item that satisfies predicate in a single pass, keeping the order of the rest.
+	// Returns the number removed.
+	template< typename Predicate >
+	SizeType removeIf(Predicate predicate)
+	{
+		return this->container.removeIf(predicate);
+	}
+
 	// O(N)
 	bool insert(const IndexType & index, const ValueType & item)
 	{
 		return this->container.insert(index, item);
 	}
+
+	// O(N)
+	bool insert(const IndexType & index, ValueType && item)
+	{
+		return this->container.insert(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceAt(const IndexType & index, Arguments && ... arguments)
+	{
+		return this->container.emplaceAt(index, stdlib::forward<Arguments>(arguments)...);
+	}
 };
\ No newline at end of file
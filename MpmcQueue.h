@@ -0,0 +1,279 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Needs <atomic>, so this is only for hosts that have it
+
+#include <stdint.h>
+#include <atomic>
+
+#include "Utility.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy >
+class MpmcQueue;
+
+// Any number of threads may enqueue and dequeue at the same time.
+// Each slot carries a sequence number that says whether it is ready to be
+// written or read for a given position, so producers and consumers only
+// contend on the position they are claiming.
+// A power of two capacity avoids a division per operation.
+template< typename Type, uintmax_t capactiyValue >
+class MpmcQueue
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create MpmcQueue with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using PositionType = decltype(sizeof(0));
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+
+private:
+
+	//
+	// Private Helper Types
+	//
+
+	struct Slot
+	{
+		std::atomic<PositionType> sequence;
+		UninitialisedStorage<ValueType, 1> item;
+	};
+
+	//
+	// Member Variables
+	//
+
+	Slot slots[capactiy];
+	alignas(64) std::atomic<PositionType> enqueuePosition { 0 };
+	alignas(64) std::atomic<PositionType> dequeuePosition { 0 };
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	Slot & getSlot(PositionType position)
+	{
+		return this->slots[position % capactiy];
+	}
+
+	// O(1)
+	static intptr_t difference(PositionType left, PositionType right) noexcept
+	{
+		return static_cast<intptr_t>(left - right);
+	}
+
+public:
+
+	//
+	// Constructors, Destructor and Assignment
+	//
+
+	// O(N)
+	MpmcQueue();
+
+	MpmcQueue(const MpmcQueue &) = delete;
+
+	MpmcQueue & operator =(const MpmcQueue &) = delete;
+
+	// O(N)
+	// Must not be destroyed while any thread is still using it
+	~MpmcQueue();
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	// Only a snapshot while other threads are active
+	bool isEmpty() const noexcept
+	{
+		return (this->getCount() == 0);
+	}
+
+	// O(1)
+	// Only a snapshot while other threads are active
+	bool isFull() const noexcept
+	{
+		return (this->getCount() == capactiy);
+	}
+
+	// O(1)
+	// Only a snapshot while other threads are active
+	SizeType getCount() const noexcept;
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	bool enqueue(const ValueType & item)
+	{
+		return this->emplace(item);
+	}
+
+	// O(1)
+	bool enqueue(ValueType && item)
+	{
+		return this->emplace(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments);
+
+	// O(1)
+	// There is no peek, because another consumer could take the item in between.
+	// Moves the first item into destination.
+	// Returns true on success, false if the queue was empty.
+	bool dequeue(ValueType & destination);
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+MpmcQueue<Type, capactiy>::MpmcQueue()
+{
+	for (PositionType i = 0; i < capactiy; ++i)
+		this->slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy >
+MpmcQueue<Type, capactiy>::~MpmcQueue()
+{
+	const PositionType end = this->enqueuePosition.load(std::memory_order_acquire);
+
+	for (PositionType position = this->dequeuePosition.load(std::memory_order_acquire); position != end; ++position)
+		this->getSlot(position).item.destroy(0);
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+auto MpmcQueue<Type, capactiy>::getCount() const noexcept -> SizeType
+{
+	const PositionType dequeued = this->dequeuePosition.load(std::memory_order_acquire);
+	const PositionType enqueued = this->enqueuePosition.load(std::memory_order_acquire);
+
+	// The positions are read separately, so clamp anything out of range
+	const intptr_t count = difference(enqueued, dequeued);
+	return (count < 0) ? 0 : (static_cast<PositionType>(count) > capactiy) ? capactiy : static_cast<SizeType>(count);
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+template< typename ... Arguments >
+bool MpmcQueue<Type, capactiy>::emplace(Arguments && ... arguments)
+{
+	PositionType position = this->enqueuePosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		Slot & slot = this->getSlot(position);
+		const intptr_t state = difference(slot.sequence.load(std::memory_order_acquire), position);
+
+		// The slot is free for this position, try to claim it
+		if (state == 0)
+		{
+			if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				slot.item.construct(0, stdlib::forward<Arguments>(arguments)...);
+				slot.sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		// The slot still holds an item from the previous lap
+		else if (state < 0)
+		{
+			return false;
+		}
+		// Another producer claimed this position first
+		else
+		{
+			position = this->enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy >
+bool MpmcQueue<Type, capactiy>::dequeue(ValueType & destination)
+{
+	PositionType position = this->dequeuePosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		Slot & slot = this->getSlot(position);
+		const intptr_t state = difference(slot.sequence.load(std::memory_order_acquire), position + 1);
+
+		// The slot holds the item for this position, try to claim it
+		if (state == 0)
+		{
+			if (this->dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				destination = stdlib::move(slot.item[0]);
+				slot.item.destroy(0);
+				slot.sequence.store(position + capactiy, std::memory_order_release);
+				return true;
+			}
+		}
+		// Nothing has been written for this position yet
+		else if (state < 0)
+		{
+			return false;
+		}
+		// Another consumer claimed this position first
+		else
+		{
+			position = this->dequeuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
\ No newline at end of file
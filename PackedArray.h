@@ -0,0 +1,430 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+#include <string.h>
+
+#include "IntegerTypes.h"
+
+//
+// Declarations
+//
+
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+class PackedArray;
+
+// capactiy unsigned values of bitsPerElement bits each, packed end to end.
+// Item N starts at bit (N * bitsPerElement), counting from the lowest bit of the first byte,
+// so an item may be split across two bytes.
+// Any bits past the last item are always kept clear.
+template< uint8_t bitsPerElementValue, uintmax_t capactiyValue >
+class PackedArray
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create PackedArray with a capacity less than 1");
+	static_assert((bitsPerElementValue > 0) && (bitsPerElementValue <= 8), "PackedArray elements must be between 1 and 8 bits");
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = uint8_t;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using IndexOfType = SmallestSignedType<capactiyValue - 1>;
+	using BitIndexType = SmallestUnsignedType<capactiyValue * bitsPerElementValue>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const IndexType FirstIndex = 0;
+	constexpr static const IndexType LastIndex = capactiy - 1;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+	constexpr static const uint8_t BitsPerElement = bitsPerElementValue;
+	constexpr static const ValueType MaxValue = static_cast<ValueType>((1u << bitsPerElementValue) - 1);
+	constexpr static const uintmax_t ByteCount = (((capactiyValue * bitsPerElementValue) + 7) / 8);
+
+	//
+	// Reference
+	//
+
+	// Stands in for a ValueType & to a single item
+	class Reference
+	{
+	private:
+		PackedArray & array;
+		IndexType index;
+
+	public:
+		Reference(PackedArray & array, IndexType index) noexcept
+			: array(array), index(index)
+		{
+		}
+
+		operator ValueType() const noexcept
+		{
+			return this->array.getItem(this->index);
+		}
+
+		Reference & operator =(ValueType value) noexcept
+		{
+			this->array.setItem(this->index, value);
+			return *this;
+		}
+
+		Reference & operator =(const Reference & other) noexcept
+		{
+			return (*this = static_cast<ValueType>(other));
+		}
+	};
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	uint8_t bytes[ByteCount] = {};
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	static BitIndexType getBitIndex(IndexType index) noexcept
+	{
+		return static_cast<BitIndexType>(static_cast<BitIndexType>(index) * bitsPerElementValue);
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return false;
+	}
+
+	// O(1)
+	constexpr bool isFull() const noexcept
+	{
+		return true;
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	// The packed bytes
+	uint8_t * getBytes() noexcept
+	{
+		return &this->bytes[0];
+	}
+
+	// O(1)
+	const uint8_t * getBytes() const noexcept
+	{
+		return &this->bytes[0];
+	}
+
+	// O(1)
+	Reference operator [](const IndexType & index) noexcept
+	{
+		return Reference(*this, index);
+	}
+
+	// O(1)
+	ValueType operator [](const IndexType & index) const noexcept
+	{
+		return this->getItem(index);
+	}
+
+	// O(N)
+	// Sets every item to 0
+	void clear() noexcept
+	{
+		memset(&this->bytes[0], 0, ByteCount);
+	}
+
+	// O(N)
+	void fill(ValueType item) noexcept;
+
+	// O(N)
+	bool contains(ValueType item) const noexcept
+	{
+		return (this->indexOfFirst(item) != InvalidIndex);
+	}
+
+	// O(N)
+	IndexOfType indexOfFirst(ValueType item) const noexcept;
+
+	// O(N)
+	IndexOfType indexOfLast(ValueType item) const noexcept;
+
+	// O(N)
+	SizeType count(ValueType item) const noexcept;
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	ValueType getItem(IndexType index) const noexcept;
+
+	// O(1)
+	// Only the lowest bitsPerElement bits of value are kept
+	void setItem(IndexType index, ValueType value) noexcept;
+
+	// O(N)
+	// Copies up to count items starting at index out into one byte each,
+	// returns the number copied
+	SizeType unpackRange(IndexType index, ValueType * destination, SizeType count) const noexcept;
+
+	// O(N)
+	// Copies up to count bytes in as items starting at index,
+	// keeping only the lowest bitsPerElement bits of each,
+	// returns the number copied
+	SizeType packRange(IndexType index, const ValueType * source, SizeType count) noexcept;
+};
+
+//
+// Definition
+//
+
+// O(1)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::getItem(IndexType index) const noexcept -> ValueType
+{
+	const BitIndexType bit = getBitIndex(index);
+	const BitIndexType byte = (bit / 8);
+	const uint8_t shift = (bit % 8);
+
+	uint_fast16_t value = (this->bytes[byte] >> shift);
+
+	if ((shift + bitsPerElement) > 8)
+		value |= (static_cast<uint_fast16_t>(this->bytes[byte + 1]) << (8 - shift));
+
+	return static_cast<ValueType>(value & MaxValue);
+}
+
+// O(1)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+void PackedArray<bitsPerElement, capactiy>::setItem(IndexType index, ValueType value) noexcept
+{
+	const BitIndexType bit = getBitIndex(index);
+	const BitIndexType byte = (bit / 8);
+	const uint8_t shift = (bit % 8);
+
+	const uint_fast16_t mask = (static_cast<uint_fast16_t>(MaxValue) << shift);
+	const uint_fast16_t bits = (static_cast<uint_fast16_t>(value & MaxValue) << shift);
+
+	this->bytes[byte] = static_cast<uint8_t>((this->bytes[byte] & ~mask) | bits);
+
+	if ((shift + bitsPerElement) > 8)
+		this->bytes[byte + 1] = static_cast<uint8_t>((this->bytes[byte + 1] & ~(mask >> 8)) | (bits >> 8));
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+void PackedArray<bitsPerElement, capactiy>::fill(ValueType item) noexcept
+{
+	// Eight items always take up exactly bitsPerElement bytes,
+	// so set the first eight and then repeat those bytes
+	const IndexType patternCount = (capactiy < 8) ? capactiy : 8;
+
+	for (IndexType index = 0; index < patternCount; ++index)
+		this->setItem(index, item);
+
+	for (uintmax_t byte = bitsPerElement; byte < ByteCount; ++byte)
+		this->bytes[byte] = this->bytes[byte - bitsPerElement];
+
+	// Keep the bits past the last item clear
+	constexpr uint8_t usedBits = ((capactiy * bitsPerElement) % 8);
+
+	if (usedBits != 0)
+		this->bytes[ByteCount - 1] &= static_cast<uint8_t>((1u << usedBits) - 1);
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::indexOfFirst(ValueType item) const noexcept -> IndexOfType
+{
+	// Read the bytes in order, topping up a small buffer whenever it runs low
+	uint_fast16_t buffer = 0;
+	uint8_t available = 0;
+	uintmax_t byte = 0;
+
+	for (IndexType index = 0; index < capactiy; ++index)
+	{
+		if (available < bitsPerElement)
+		{
+			buffer |= (static_cast<uint_fast16_t>(this->bytes[byte]) << available);
+			available += 8;
+			++byte;
+		}
+
+		if ((buffer & MaxValue) == item)
+			return static_cast<IndexOfType>(index);
+
+		buffer >>= bitsPerElement;
+		available -= bitsPerElement;
+	}
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::indexOfLast(ValueType item) const noexcept -> IndexOfType
+{
+	for (IndexType index = capactiy; index > 0; --index)
+		if (this->getItem(index - 1) == item)
+			return static_cast<IndexOfType>(index - 1);
+
+	return InvalidIndex;
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::count(ValueType item) const noexcept -> SizeType
+{
+	uint_fast16_t buffer = 0;
+	uint8_t available = 0;
+	uintmax_t byte = 0;
+
+	SizeType result = 0;
+
+	for (IndexType index = 0; index < capactiy; ++index)
+	{
+		if (available < bitsPerElement)
+		{
+			buffer |= (static_cast<uint_fast16_t>(this->bytes[byte]) << available);
+			available += 8;
+			++byte;
+		}
+
+		if ((buffer & MaxValue) == item)
+			++result;
+
+		buffer >>= bitsPerElement;
+		available -= bitsPerElement;
+	}
+
+	return result;
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::unpackRange(IndexType index, ValueType * destination, SizeType count) const noexcept -> SizeType
+{
+	if (index >= capactiy)
+		return 0;
+
+	const SizeType space = (capactiy - index);
+	const SizeType amount = (count < space) ? count : space;
+
+	const BitIndexType bit = getBitIndex(index);
+	BitIndexType byte = (bit / 8);
+
+	if (amount == 0)
+		return 0;
+
+	// Start part way through the first byte
+	uint_fast16_t buffer = (this->bytes[byte] >> (bit % 8));
+	uint8_t available = (8 - (bit % 8));
+	++byte;
+
+	for (SizeType i = 0; i < amount; ++i)
+	{
+		if (available < bitsPerElement)
+		{
+			buffer |= (static_cast<uint_fast16_t>(this->bytes[byte]) << available);
+			available += 8;
+			++byte;
+		}
+
+		destination[i] = static_cast<ValueType>(buffer & MaxValue);
+		buffer >>= bitsPerElement;
+		available -= bitsPerElement;
+	}
+
+	return amount;
+}
+
+// O(N)
+template< uint8_t bitsPerElement, uintmax_t capactiy >
+auto PackedArray<bitsPerElement, capactiy>::packRange(IndexType index, const ValueType * source, SizeType count) noexcept -> SizeType
+{
+	if (index >= capactiy)
+		return 0;
+
+	const SizeType space = (capactiy - index);
+	const SizeType amount = (count < space) ? count : space;
+
+	if (amount == 0)
+		return 0;
+
+	const BitIndexType bit = getBitIndex(index);
+	BitIndexType byte = (bit / 8);
+
+	// Keep whatever comes before the first item in its byte
+	uint8_t filled = (bit % 8);
+	uint_fast16_t buffer = (this->bytes[byte] & ((1u << filled) - 1));
+
+	for (SizeType i = 0; i < amount; ++i)
+	{
+		buffer |= (static_cast<uint_fast16_t>(source[i] & MaxValue) << filled);
+		filled += bitsPerElement;
+
+		if (filled >= 8)
+		{
+			this->bytes[byte] = static_cast<uint8_t>(buffer);
+			buffer >>= 8;
+			filled -= 8;
+			++byte;
+		}
+	}
+
+	// Keep whatever comes after the last item in its byte
+	if (filled > 0)
+		this->bytes[byte] = static_cast<uint8_t>((this->bytes[byte] & ~((1u << filled) - 1)) | buffer);
+
+	return amount;
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "IntegerTypes.h"
+#include "PackedArray.h"
+
+template< uint8_t bitsPerElement, uintmax_t Width, uintmax_t Height >
+class PackedGrid;
+
+// A Grid of bitsPerElement bit values, stored row by row in a PackedArray
+template< uint8_t bitsPerElementValue, uintmax_t WidthValue, uintmax_t HeightValue >
+class PackedGrid
+{
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using StorageType = PackedArray<bitsPerElementValue, WidthValue * HeightValue>;
+
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = typename StorageType::ValueType;
+	using Reference = typename StorageType::Reference;
+	using SizeType = typename StorageType::SizeType;
+	using IndexType = typename StorageType::IndexType;
+	using IndexOfType = typename StorageType::IndexOfType;
+	using DimensionType = SmallestUnsignedType<((WidthValue > HeightValue) ? WidthValue : HeightValue)>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const DimensionType Width = WidthValue;
+	constexpr static const DimensionType Height = HeightValue;
+	constexpr static const SizeType Capacity = StorageType::capactiy;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+	constexpr static const uint8_t BitsPerElement = StorageType::BitsPerElement;
+	constexpr static const ValueType MaxValue = StorageType::MaxValue;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	StorageType items;
+
+	//
+	// Private Member Functions
+	//
+
+	inline IndexType flattenIndex(const DimensionType & x, const DimensionType & y) const
+	{
+		return (static_cast<IndexType>(Width) * static_cast<IndexType>(y)) + static_cast<IndexType>(x);
+	}
+
+public:
+
+	//
+	// Public Member Functions
+	//
+
+	// O(1)
+	constexpr DimensionType getWidth() const
+	{
+		return Width;
+	}
+
+	// O(1)
+	constexpr DimensionType getHeight() const
+	{
+		return Height;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	// O(1)
+	// The packed bytes, cell (x, y) is item (y * width) + x of a PackedArray
+	uint8_t * getBytes() noexcept
+	{
+		return this->items.getBytes();
+	}
+
+	// O(1)
+	const uint8_t * getBytes() const noexcept
+	{
+		return this->items.getBytes();
+	}
+
+	// O(1)
+	Reference getItem(const DimensionType & x, const DimensionType & y)
+	{
+		return this->items[this->flattenIndex(x, y)];
+	}
+
+	// O(1)
+	ValueType getItem(const DimensionType & x, const DimensionType & y) const
+	{
+		return this->items.getItem(this->flattenIndex(x, y));
+	}
+
+	// O(N)
+	void fill(ValueType value)
+	{
+		this->items.fill(value);
+	}
+
+	// O(N)
+	// Sets every cell to 0
+	void clear()
+	{
+		this->items.clear();
+	}
+
+	// O(N)
+	bool contains(ValueType value) const
+	{
+		return this->items.contains(value);
+	}
+
+	// O(N)
+	SizeType count(ValueType value) const
+	{
+		return this->items.count(value);
+	}
+
+	// O(N)
+	// Returns (y * width) + x for the first matching cell, or -1 if there is none
+	IndexOfType indexOfFirst(ValueType value) const
+	{
+		return this->items.indexOfFirst(value);
+	}
+
+	// O(N)
+	// Returns (y * width) + x for the last matching cell, or -1 if there is none
+	IndexOfType indexOfLast(ValueType value) const
+	{
+		return this->items.indexOfLast(value);
+	}
+
+	// O(Width)
+	// Copies row y out into Width bytes
+	void unpackRow(const DimensionType & y, ValueType * destination) const
+	{
+		this->items.unpackRange(this->flattenIndex(0, y), destination, Width);
+	}
+
+	// O(Width)
+	// Copies Width bytes into row y
+	void packRow(const DimensionType & y, const ValueType * source)
+	{
+		this->items.packRange(this->flattenIndex(0, y), source, Width);
+	}
+
+	// O(N)
+	// Copies the whole grid out into Width * Height bytes, row by row
+	void unpackAll(ValueType * destination) const
+	{
+		this->items.unpackRange(0, destination, Capacity);
+	}
+
+	// O(N)
+	// Copies Width * Height bytes into the whole grid, row by row
+	void packAll(const ValueType * source)
+	{
+		this->items.packRange(0, source, Capacity);
+	}
+};
\ No newline at end of file
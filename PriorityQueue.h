@@ -0,0 +1,544 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Algorithm.h"
+#include "Functional.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy, typename Compare = stdlib::less<Type> >
+class PriorityQueue;
+
+// A binary heap where peek gives the item that compares before all the others,
+// so with the default comparison the smallest item comes out first.
+// Items never move once pushed. The heap is made of handles to them,
+// and a handle stays valid until its item is popped or removed,
+// which is what allows decreaseKey.
+template< typename Type, uintmax_t capactiyValue, typename Compare >
+class PriorityQueue
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create PriorityQueue with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using CompareType = Compare;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+	using HandleType = IndexType;
+	using HandleOfType = SmallestSignedType<capactiyValue - 1>;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const HandleOfType InvalidHandle = -1;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	UninitialisedStorage<ValueType, capactiy> items;
+
+	// The first count entries are the heap, the rest are the unused handles
+	HandleType heap[capactiy];
+
+	// The position of each handle within heap
+	IndexType positions[capactiy];
+
+	SizeType count = 0;
+
+	//
+	// Private Member Functions
+	//
+
+	// O(N)
+	void resetHandles() noexcept;
+
+	// O(1)
+	bool comesBefore(IndexType left, IndexType right) const
+	{
+		return CompareType()(this->items[this->heap[left]], this->items[this->heap[right]]);
+	}
+
+	// O(1)
+	void swapEntries(IndexType left, IndexType right) noexcept;
+
+	// O(log N)
+	void siftUp(IndexType index);
+
+	// O(log N)
+	void siftDown(IndexType index);
+
+public:
+
+	//
+	// Constructors, Destructor and Assignment
+	//
+
+	// O(N)
+	PriorityQueue() noexcept
+	{
+		this->resetHandles();
+	}
+
+	// O(N)
+	PriorityQueue(const PriorityQueue & other);
+
+	// O(N)
+	PriorityQueue(PriorityQueue && other);
+
+	// O(N)
+	~PriorityQueue()
+	{
+		this->clear();
+	}
+
+	// O(N)
+	PriorityQueue & operator =(const PriorityQueue & other);
+
+	// O(N)
+	PriorityQueue & operator =(PriorityQueue && other);
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return (this->count == 0);
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return (this->count == capactiy);
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->count;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(N)
+	void clear();
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	// Return result is undefined if queue is empty
+	const ValueType & peek() const
+	{
+		return this->items[this->heap[0]];
+	}
+
+	// O(1)
+	// Return result is undefined if queue is empty
+	HandleType peekHandle() const noexcept
+	{
+		return this->heap[0];
+	}
+
+	// O(log N)
+	bool push(const ValueType & item)
+	{
+		return (this->emplaceWithHandle(item) != InvalidHandle);
+	}
+
+	// O(log N)
+	bool push(ValueType && item)
+	{
+		return (this->emplaceWithHandle(stdlib::move(item)) != InvalidHandle);
+	}
+
+	// O(log N)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments)
+	{
+		return (this->emplaceWithHandle(stdlib::forward<Arguments>(arguments)...) != InvalidHandle);
+	}
+
+	// O(log N)
+	// Returns the handle of the new item, or InvalidHandle if the queue is full
+	HandleOfType pushWithHandle(const ValueType & item)
+	{
+		return this->emplaceWithHandle(item);
+	}
+
+	// O(log N)
+	// Returns the handle of the new item, or InvalidHandle if the queue is full
+	HandleOfType pushWithHandle(ValueType && item)
+	{
+		return this->emplaceWithHandle(stdlib::move(item));
+	}
+
+	// O(log N)
+	// Returns the handle of the new item, or InvalidHandle if the queue is full
+	template< typename ... Arguments >
+	HandleOfType emplaceWithHandle(Arguments && ... arguments);
+
+	// O(log N)
+	void pop();
+
+	// O(N)
+	// Replaces the contents with up to count items from source,
+	// then orders them all at once, which is cheaper than pushing them one by one.
+	// Returns the number of items taken.
+	SizeType heapify(const ValueType * source, SizeType count);
+
+	// O(1)
+	bool isValidHandle(HandleType handle) const noexcept
+	{
+		return ((handle < capactiy) && (this->positions[handle] < this->count));
+	}
+
+	// O(1)
+	// Return result is undefined if the handle is not valid
+	const ValueType & getItem(HandleType handle) const
+	{
+		return this->items[handle];
+	}
+
+	// O(log N)
+	// The new item must not compare after the old one
+	bool decreaseKey(HandleType handle, const ValueType & item);
+
+	// O(log N)
+	// The new item must not compare after the old one
+	bool decreaseKey(HandleType handle, ValueType && item);
+
+	// O(log N)
+	// The new item may go in either direction
+	bool update(HandleType handle, const ValueType & item);
+
+	// O(log N)
+	// The new item may go in either direction
+	bool update(HandleType handle, ValueType && item);
+
+	// O(log N)
+	bool remove(HandleType handle);
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::resetHandles() noexcept
+{
+	for (IndexType index = 0; index < capactiy; ++index)
+	{
+		this->heap[index] = index;
+		this->positions[index] = index;
+	}
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::swapEntries(IndexType left, IndexType right) noexcept
+{
+	const HandleType handle = this->heap[left];
+	this->heap[left] = this->heap[right];
+	this->heap[right] = handle;
+
+	this->positions[this->heap[left]] = left;
+	this->positions[this->heap[right]] = right;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::siftUp(IndexType index)
+{
+	while (index > 0)
+	{
+		const IndexType parent = ((index - 1) / 2);
+
+		if (!this->comesBefore(index, parent))
+			break;
+
+		this->swapEntries(index, parent);
+		index = parent;
+	}
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::siftDown(IndexType index)
+{
+	// Halving first means the child index can't overflow IndexType
+	const IndexType lastParent = (this->count / 2);
+
+	while (index < lastParent)
+	{
+		IndexType child = ((index * 2) + 1);
+
+		if (((child + 1) < this->count) && this->comesBefore(child + 1, child))
+			++child;
+
+		if (!this->comesBefore(child, index))
+			break;
+
+		this->swapEntries(index, child);
+		index = child;
+	}
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+PriorityQueue<Type, capactiy, Compare>::PriorityQueue(const PriorityQueue & other)
+	: count(other.count)
+{
+	for (IndexType index = 0; index < capactiy; ++index)
+	{
+		this->heap[index] = other.heap[index];
+		this->positions[index] = other.positions[index];
+	}
+
+	for (IndexType index = 0; index < this->count; ++index)
+		this->items.construct(this->heap[index], other.items[this->heap[index]]);
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+PriorityQueue<Type, capactiy, Compare>::PriorityQueue(PriorityQueue && other)
+	: count(other.count)
+{
+	for (IndexType index = 0; index < capactiy; ++index)
+	{
+		this->heap[index] = other.heap[index];
+		this->positions[index] = other.positions[index];
+	}
+
+	for (IndexType index = 0; index < this->count; ++index)
+		this->items.construct(this->heap[index], stdlib::move(other.items[this->heap[index]]));
+
+	other.clear();
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto PriorityQueue<Type, capactiy, Compare>::operator =(const PriorityQueue & other) -> PriorityQueue &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType index = 0; index < capactiy; ++index)
+		{
+			this->heap[index] = other.heap[index];
+			this->positions[index] = other.positions[index];
+		}
+
+		for (IndexType index = 0; index < other.count; ++index)
+			this->items.construct(this->heap[index], other.items[this->heap[index]]);
+
+		this->count = other.count;
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto PriorityQueue<Type, capactiy, Compare>::operator =(PriorityQueue && other) -> PriorityQueue &
+{
+	if (this != &other)
+	{
+		this->clear();
+
+		for (IndexType index = 0; index < capactiy; ++index)
+		{
+			this->heap[index] = other.heap[index];
+			this->positions[index] = other.positions[index];
+		}
+
+		for (IndexType index = 0; index < other.count; ++index)
+			this->items.construct(this->heap[index], stdlib::move(other.items[this->heap[index]]));
+
+		this->count = other.count;
+		other.clear();
+	}
+	return *this;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::clear()
+{
+	for (IndexType index = 0; index < this->count; ++index)
+		this->items.destroy(this->heap[index]);
+
+	this->count = 0;
+	this->resetHandles();
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+template< typename ... Arguments >
+auto PriorityQueue<Type, capactiy, Compare>::emplaceWithHandle(Arguments && ... arguments) -> HandleOfType
+{
+	if (this->isFull())
+		return InvalidHandle;
+
+	const HandleType handle = this->heap[this->count];
+	this->items.construct(handle, stdlib::forward<Arguments>(arguments)...);
+
+	++this->count;
+	this->siftUp(this->count - 1);
+
+	return static_cast<HandleOfType>(handle);
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+void PriorityQueue<Type, capactiy, Compare>::pop()
+{
+	if (this->isEmpty())
+		return;
+
+	this->items.destroy(this->heap[0]);
+
+	// The popped handle ends up just past the heap, ready for reuse
+	--this->count;
+	this->swapEntries(0, this->count);
+	this->siftDown(0);
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto PriorityQueue<Type, capactiy, Compare>::heapify(const ValueType * source, SizeType count) -> SizeType
+{
+	this->clear();
+
+	const SizeType amount = (count < capactiy) ? count : capactiy;
+
+	// After clearing, handle N sits at position N
+	stdlib::uninitialized_copy(source, source + amount, this->items.getData());
+	this->count = amount;
+
+	for (IndexType index = (amount / 2); index > 0; --index)
+		this->siftDown(index - 1);
+
+	return amount;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool PriorityQueue<Type, capactiy, Compare>::decreaseKey(HandleType handle, const ValueType & item)
+{
+	if (!this->isValidHandle(handle))
+		return false;
+
+	this->items[handle] = item;
+	this->siftUp(this->positions[handle]);
+	return true;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool PriorityQueue<Type, capactiy, Compare>::decreaseKey(HandleType handle, ValueType && item)
+{
+	if (!this->isValidHandle(handle))
+		return false;
+
+	this->items[handle] = stdlib::move(item);
+	this->siftUp(this->positions[handle]);
+	return true;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool PriorityQueue<Type, capactiy, Compare>::update(HandleType handle, const ValueType & item)
+{
+	if (!this->isValidHandle(handle))
+		return false;
+
+	this->items[handle] = item;
+	this->siftUp(this->positions[handle]);
+	this->siftDown(this->positions[handle]);
+	return true;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool PriorityQueue<Type, capactiy, Compare>::update(HandleType handle, ValueType && item)
+{
+	if (!this->isValidHandle(handle))
+		return false;
+
+	this->items[handle] = stdlib::move(item);
+	this->siftUp(this->positions[handle]);
+	this->siftDown(this->positions[handle]);
+	return true;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool PriorityQueue<Type, capactiy, Compare>::remove(HandleType handle)
+{
+	if (!this->isValidHandle(handle))
+		return false;
+
+	const IndexType index = this->positions[handle];
+	this->items.destroy(handle);
+
+	--this->count;
+	this->swapEntries(index, this->count);
+
+	// The item moved into the gap may need to go either way
+	if (index < this->count)
+	{
+		const HandleType moved = this->heap[index];
+		this->siftUp(index);
+		this->siftDown(this->positions[moved]);
+	}
+
+	return true;
+}
\ No newline at end of file
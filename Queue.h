@@ -16,18 +16,19 @@
 //  limitations under the License.
 //
 
+#include <stddef.h>
 #include <stdint.h>
 
-#include "Deque.h"
+#include "CircularDeque.h"
 
 //
 // Declarations
 //
 
-template< typename Type, uint8_t capactiy, typename Container = Deque<Type, capactiy> >
+template< typename Type, uintmax_t capactiy, typename Container = CircularDeque<Type, capactiy> >
 class Queue;
 
-template< typename Type, uint8_t capactiyValue, typename Container >
+template< typename Type, uintmax_t capactiyValue, typename Container >
 class Queue
 {
 public:
@@ -37,7 +38,6 @@ public:
 	//
 
 	//static_assert(capactiyValue > 0, "Attempt to create Queue with a capacity less than 1");
-	static_assert(capactiyValue < 128, "Attempt to create Queue with a capacity greater than 127");
 
 	//
 	// Type Aliases
@@ -48,6 +48,8 @@ public:
 	using SizeType = typename ContainerType::SizeType;
 	using IndexType = typename ContainerType::IndexType;
 	using IndexOfType = typename ContainerType::IndexOfType;
+	using Iterator = typename ContainerType::Iterator;
+	using ConstIterator = typename ContainerType::ConstIterator;
 	
 	//
 	// Constants
@@ -120,6 +122,31 @@ public:
 		return this->container[index];
 	}
 	
+	// O(1)
+	// Goes from the front of the queue to the back
+	Iterator begin()
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	ConstIterator begin() const
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	Iterator end()
+	{
+		return this->container.end();
+	}
+
+	// O(1)
+	ConstIterator end() const
+	{
+		return this->container.end();
+	}
+	
 	// O(N)
 	void clear()
 	{
@@ -149,6 +176,18 @@ public:
 	{
 		return this->container.indexOfLast(item);
 	}
+
+	// O(N)
+	SizeType count(const ValueType & item) const
+	{
+		return this->container.count(item);
+	}
+
+	// O(N)
+	IndexOfType indexOfAny(const ValueType * set, size_t count) const
+	{
+		return this->container.indexOfAny(set, count);
+	}
 	
 public:
 
@@ -174,11 +213,46 @@ public:
 		return this->container.append(item);
 	}
 
+	// O(1)
+	bool enqueue(ValueType && item)
+	{
+		return this->container.append(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments)
+	{
+		return this->container.emplaceBack(stdlib::forward<Arguments>(arguments)...);
+	}
+
+	// O(N)
+	// Enqueues as many items as will fit, returns the number enqueued
+	SizeType enqueueRange(const ValueType * source, SizeType count)
+	{
+		return this->container.appendRange(source, count);
+	}
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType enqueueRange(const OtherContainer & container)
+	{
+		return this->container.appendRange(container);
+	}
+
 	// O(1)
 	void dequeue()
 	{
 		this->container.unprepend();
 	}
+
+	// O(N)
+	// Moves up to count items out of the queue into destination, in the order they were enqueued,
+	// returns the number moved
+	SizeType dequeueInto(ValueType * destination, SizeType count)
+	{
+		return this->container.unprependInto(destination, count);
+	}
 	
 	// O(N)
 	bool removeFirst(const ValueType & item)
@@ -203,4 +277,17 @@ public:
 	{
 		return this->container.insert(index, item);
 	}
+
+	// O(N)
+	bool insert(const IndexType & index, ValueType && item)
+	{
+		return this->container.insert(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceAt(const IndexType & index, Arguments && ... arguments)
+	{
+		return this->container.emplaceAt(index, stdlib::forward<Arguments>(arguments)...);
+	}
 };
\ No newline at end of file
@@ -0,0 +1,337 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Utility.h"
+#include "IntegerTypes.h"
+#include "Span.h"
+
+//
+// Declarations
+//
+
+template< uintmax_t capactiy, typename ... Fields >
+class SoAArray;
+
+namespace details
+{
+	template< uintmax_t capactiy, typename ... Fields >
+	class SoAColumns;
+
+	template< size_t field, uintmax_t capactiy, typename ... Fields >
+	struct SoAColumnAt;
+}
+
+//
+// details::SoAColumns
+//
+
+namespace details
+{
+	// Each level holds the column for one field and inherits the columns for the rest,
+	// so every whole entry operation recurses once per field
+
+	template< uintmax_t capactiy >
+	class SoAColumns<capactiy>
+	{
+	public:
+		// O(1)
+		void moveEntry(size_t, size_t)
+		{
+		}
+
+		// O(1)
+		void swapEntries(size_t, size_t)
+		{
+		}
+
+		// O(1)
+		void assignEntry(size_t)
+		{
+		}
+	};
+
+	template< uintmax_t capactiy, typename Field, typename ... Fields >
+	class SoAColumns<capactiy, Field, Fields...> : public SoAColumns<capactiy, Fields...>
+	{
+	private:
+		using BaseType = SoAColumns<capactiy, Fields...>;
+
+	public:
+		// A plain array rather than Array, which packs bool into bits,
+		// so that a bool field can still be referenced and given as a Span
+		Field column[capactiy] = {};
+
+	public:
+		// O(F)
+		void moveEntry(size_t target, size_t source)
+		{
+			this->column[target] = stdlib::move(this->column[source]);
+			BaseType::moveEntry(target, source);
+		}
+
+		// O(F)
+		void swapEntries(size_t left, size_t right)
+		{
+			stdlib::swap(this->column[left], this->column[right]);
+			BaseType::swapEntries(left, right);
+		}
+
+		// O(F)
+		template< typename Argument, typename ... Arguments >
+		void assignEntry(size_t index, Argument && argument, Arguments && ... arguments)
+		{
+			this->column[index] = stdlib::forward<Argument>(argument);
+			BaseType::assignEntry(index, stdlib::forward<Arguments>(arguments)...);
+		}
+	};
+}
+
+//
+// details::SoAColumnAt
+//
+
+namespace details
+{
+	template< size_t field, uintmax_t capactiy, typename Field, typename ... Fields >
+	struct SoAColumnAt<field, capactiy, Field, Fields...>
+	{
+		using Type = typename SoAColumnAt<field - 1, capactiy, Fields...>::Type;
+		using ColumnsType = typename SoAColumnAt<field - 1, capactiy, Fields...>::ColumnsType;
+	};
+
+	template< uintmax_t capactiy, typename Field, typename ... Fields >
+	struct SoAColumnAt<0, capactiy, Field, Fields...>
+	{
+		using Type = Field;
+		using ColumnsType = SoAColumns<capactiy, Field, Fields...>;
+	};
+}
+
+//
+// SoAArray
+//
+
+// A List of entries made of several fields, where each field is stored in an array of its own.
+// A loop that only reads some of the fields then only reads their memory,
+// instead of every field of every entry it passes.
+// Fields are numbered from 0 in the order they are given,
+// so get<0>(index) is the first field of the entry at index
+// and getColumn<0>() is a Span of the first field of every entry.
+template< uintmax_t capactiyValue, typename ... Fields >
+class SoAArray
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create SoAArray with a capacity less than 1");
+	static_assert(sizeof...(Fields) > 0, "Attempt to create SoAArray with no fields");
+
+	//
+	// Type Aliases
+	//
+
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+
+	template< size_t field >
+	using FieldType = typename details::SoAColumnAt<field, capactiyValue, Fields...>::Type;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+	constexpr static const size_t FieldCount = sizeof...(Fields);
+
+private:
+
+	//
+	// Private Type Aliases
+	//
+
+	using ColumnsType = details::SoAColumns<capactiyValue, Fields...>;
+
+	template< size_t field >
+	using ColumnType = typename details::SoAColumnAt<field, capactiyValue, Fields...>::ColumnsType;
+
+	//
+	// Member Variables
+	//
+
+	ColumnsType columns;
+	SizeType count = 0;
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return (this->count == 0);
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return (this->count == capactiy);
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->count;
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+	// O(1)
+	// Forgets every entry. The fields are overwritten as new entries are added.
+	void clear() noexcept
+	{
+		this->count = 0;
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	// The field numbered field of the entry at index
+	template< size_t field >
+	FieldType<field> & get(IndexType index)
+	{
+		return static_cast<ColumnType<field> &>(this->columns).column[index];
+	}
+
+	// O(1)
+	template< size_t field >
+	const FieldType<field> & get(IndexType index) const
+	{
+		return static_cast<const ColumnType<field> &>(this->columns).column[index];
+	}
+
+	// O(1)
+	// The field numbered field of every entry, in order
+	template< size_t field >
+	Span<FieldType<field>> getColumn() noexcept
+	{
+		return Span<FieldType<field>>(static_cast<ColumnType<field> &>(this->columns).column, this->count);
+	}
+
+	// O(1)
+	template< size_t field >
+	Span<const FieldType<field>> getColumn() const noexcept
+	{
+		return Span<const FieldType<field>>(static_cast<const ColumnType<field> &>(this->columns).column, this->count);
+	}
+
+	// O(F)
+	// Takes one argument per field, in order.
+	// Returns false if the array is full.
+	template< typename ... Arguments >
+	bool add(Arguments && ... arguments);
+
+	// O(F)
+	// Replaces every field of the entry at index
+	template< typename ... Arguments >
+	void set(IndexType index, Arguments && ... arguments);
+
+	// O(F)
+	// Moves the last entry into index, instead of shifting every entry after it
+	bool removeAtUnordered(IndexType index);
+
+	// O(1)
+	// Removes the last entry
+	bool unappend();
+
+	// O(F)
+	void swapEntries(IndexType left, IndexType right)
+	{
+		this->columns.swapEntries(left, right);
+	}
+};
+
+//
+// Definition
+//
+
+// O(F)
+template< uintmax_t capactiy, typename ... Fields >
+template< typename ... Arguments >
+bool SoAArray<capactiy, Fields...>::add(Arguments && ... arguments)
+{
+	static_assert(sizeof...(Arguments) == sizeof...(Fields), "SoAArray::add takes one argument per field");
+
+	if (this->isFull())
+		return false;
+
+	this->columns.assignEntry(this->count, stdlib::forward<Arguments>(arguments)...);
+	++this->count;
+	return true;
+}
+
+// O(F)
+template< uintmax_t capactiy, typename ... Fields >
+template< typename ... Arguments >
+void SoAArray<capactiy, Fields...>::set(IndexType index, Arguments && ... arguments)
+{
+	static_assert(sizeof...(Arguments) == sizeof...(Fields), "SoAArray::set takes one argument per field");
+
+	this->columns.assignEntry(index, stdlib::forward<Arguments>(arguments)...);
+}
+
+// O(F)
+template< uintmax_t capactiy, typename ... Fields >
+bool SoAArray<capactiy, Fields...>::removeAtUnordered(IndexType index)
+{
+	if (index >= this->count)
+		return false;
+
+	--this->count;
+
+	if (index != this->count)
+		this->columns.moveEntry(index, this->count);
+
+	return true;
+}
+
+// O(1)
+template< uintmax_t capactiy, typename ... Fields >
+bool SoAArray<capactiy, Fields...>::unappend()
+{
+	if (this->count == 0)
+		return false;
+
+	--this->count;
+	return true;
+}
\ No newline at end of file
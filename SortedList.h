@@ -0,0 +1,342 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Algorithm.h"
+#include "Functional.h"
+#include "Deque.h"
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy, typename Compare = stdlib::less<Type> >
+class SortedList;
+
+// A List that keeps its items in order, so lookups are binary searches.
+// Items that compare equivalent are kept in the order they were added.
+// There is no way to change an item in place, because that could break the order,
+// so remove it and add the new value instead.
+template< typename Type, uintmax_t capactiyValue, typename Compare >
+class SortedList
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ContainerType = Deque<Type, capactiyValue>;
+	using ValueType = typename ContainerType::ValueType;
+	using SizeType = typename ContainerType::SizeType;
+	using IndexType = typename ContainerType::IndexType;
+	using IndexOfType = typename ContainerType::IndexOfType;
+	using ConstIterator = typename ContainerType::ConstIterator;
+	using CompareType = Compare;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = ContainerType::capactiy;
+	constexpr static const IndexOfType InvalidIndex = ContainerType::InvalidIndex;
+	constexpr static const IndexType FirstIndex = ContainerType::FirstIndex;
+	constexpr static const IndexType LastIndex = ContainerType::LastIndex;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	ContainerType container;
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	static bool isEquivalent(const ValueType & left, const ValueType & right)
+	{
+		return !CompareType()(left, right) && !CompareType()(right, left);
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return this->container.isEmpty();
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return this->container.isFull();
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return this->container.getCount();
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return this->container.getCapacity();
+	}
+
+	// O(1)
+	const ValueType * getData() const noexcept
+	{
+		return this->container.getData();
+	}
+
+	// O(1)
+	const ValueType & operator [](const IndexType & index) const
+	{
+		return this->container[index];
+	}
+
+	// O(1)
+	ConstIterator begin() const
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	ConstIterator end() const
+	{
+		return this->container.end();
+	}
+
+	// O(N)
+	void clear()
+	{
+		this->container.clear();
+	}
+
+	// O(log N)
+	bool contains(const ValueType & item) const
+	{
+		return (this->indexOfFirst(item) != InvalidIndex);
+	}
+
+	// O(log N)
+	IndexOfType indexOfFirst(const ValueType & item) const;
+
+	// O(log N)
+	IndexOfType indexOfLast(const ValueType & item) const;
+
+	// O(log N)
+	SizeType count(const ValueType & item) const
+	{
+		return static_cast<SizeType>(this->upperBound(item) - this->lowerBound(item));
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	const ValueType & getFirst() const
+	{
+		return this->container.getFirst();
+	}
+
+	// O(1)
+	const ValueType & getLast() const
+	{
+		return this->container.getLast();
+	}
+
+	// O(log N)
+	// The index of the first item that does not compare before item, or getCount() if there is none
+	IndexType lowerBound(const ValueType & item) const;
+
+	// O(log N)
+	// The index of the first item that compares after item, or getCount() if there is none
+	IndexType upperBound(const ValueType & item) const;
+
+	// O(N)
+	// Goes after any equivalent items
+	bool add(const ValueType & item)
+	{
+		return this->container.insert(this->upperBound(item), item);
+	}
+
+	// O(N)
+	bool add(ValueType && item)
+	{
+		const IndexType index = this->upperBound(item);
+		return this->container.insert(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments)
+	{
+		if (this->isFull())
+			return false;
+
+		return this->add(ValueType(stdlib::forward<Arguments>(arguments)...));
+	}
+
+	// O(N + M)
+	// source must already be in order.
+	// Merges as many of the first items of source as will fit,
+	// returns the number added
+	SizeType insertMany(const ValueType * source, SizeType count);
+
+	// O(N + M)
+	template< typename OtherContainer >
+	SizeType insertMany(const OtherContainer & container)
+	{
+		const auto count = container.getCount();
+		return this->insertMany(container.getData(), (count < capactiy) ? static_cast<SizeType>(count) : capactiy);
+	}
+
+	// O(N)
+	bool removeFirst(const ValueType & item);
+
+	// O(N)
+	bool removeLast(const ValueType & item);
+
+	// O(N)
+	bool removeAt(const IndexType & index)
+	{
+		return this->container.removeAt(index);
+	}
+};
+
+//
+// Definition
+//
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto SortedList<Type, capactiy, Compare>::lowerBound(const ValueType & item) const -> IndexType
+{
+	const ValueType * const data = this->container.getData();
+	return static_cast<IndexType>(stdlib::lower_bound(data, data + this->container.getCount(), item, CompareType()) - data);
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto SortedList<Type, capactiy, Compare>::upperBound(const ValueType & item) const -> IndexType
+{
+	const ValueType * const data = this->container.getData();
+	return static_cast<IndexType>(stdlib::upper_bound(data, data + this->container.getCount(), item, CompareType()) - data);
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto SortedList<Type, capactiy, Compare>::indexOfFirst(const ValueType & item) const -> IndexOfType
+{
+	const IndexType index = this->lowerBound(item);
+
+	if ((index < this->container.getCount()) && isEquivalent(this->container[index], item))
+		return static_cast<IndexOfType>(index);
+
+	return InvalidIndex;
+}
+
+// O(log N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto SortedList<Type, capactiy, Compare>::indexOfLast(const ValueType & item) const -> IndexOfType
+{
+	const IndexType index = this->upperBound(item);
+
+	if ((index > 0) && isEquivalent(this->container[index - 1], item))
+		return static_cast<IndexOfType>(index - 1);
+
+	return InvalidIndex;
+}
+
+// O(N + M)
+template< typename Type, uintmax_t capactiy, typename Compare >
+auto SortedList<Type, capactiy, Compare>::insertMany(const ValueType * source, SizeType count) -> SizeType
+{
+	const SizeType oldCount = this->container.getCount();
+
+	// Fill the free slots first so that every slot the merge writes to holds an item
+	const SizeType amount = this->container.appendRange(source, count);
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->container.getData();
+
+	// Merge from the back, so no existing item is overwritten before it has been moved.
+	// Once source runs out, the remaining existing items are already in place.
+	IndexType existing = oldCount;
+	IndexType added = amount;
+	IndexType target = (oldCount + amount);
+
+	while (added > 0)
+	{
+		--target;
+
+		if ((existing > 0) && CompareType()(source[added - 1], data[existing - 1]))
+		{
+			--existing;
+			data[target] = stdlib::move(data[existing]);
+		}
+		else
+		{
+			--added;
+			data[target] = source[added];
+		}
+	}
+
+	return amount;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool SortedList<Type, capactiy, Compare>::removeFirst(const ValueType & item)
+{
+	const IndexOfType index = this->indexOfFirst(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->container.removeAt(static_cast<IndexType>(index));
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, typename Compare >
+bool SortedList<Type, capactiy, Compare>::removeLast(const ValueType & item)
+{
+	const IndexOfType index = this->indexOfLast(item);
+
+	if (index == InvalidIndex)
+		return false;
+
+	return this->container.removeAt(static_cast<IndexType>(index));
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TypeTraits.h"
+#include "Algorithm.h"
+
+//
+// Declarations
+//
+
+template< typename Type >
+class Span;
+
+// A view of count contiguous items that belong to something else.
+// Any container with getData() and getCount() converts to a Span,
+// so a function can take a Span instead of being a template over every container.
+// Use Span<const Type> for a read only view.
+// A Span is only valid for as long as the items it views stay where they are.
+template< typename Type >
+class Span
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = size_t;
+	using IndexType = size_t;
+	using IndexOfType = ptrdiff_t;
+	using Iterator = ValueType *;
+	using ConstIterator = ValueType *;
+
+	//
+	// Constants
+	//
+
+	constexpr static const IndexType FirstIndex = 0;
+	constexpr static const IndexOfType InvalidIndex = -1;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	ValueType * data = nullptr;
+	SizeType itemCount = 0;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(1)
+	constexpr Span() noexcept = default;
+
+	// O(1)
+	constexpr Span(ValueType * data, SizeType count) noexcept
+		: data(data), itemCount(count)
+	{
+	}
+
+	// O(1)
+	template< size_t size >
+	constexpr Span(ValueType (&array)[size]) noexcept
+		: data(&array[0]), itemCount(size)
+	{
+	}
+
+	// O(1)
+	// Converts a Span<Type> to a Span<const Type>
+	template< typename Other, typename = decltype(stdlib::declval<ValueType * &>() = stdlib::declval<Other *>()) >
+	constexpr Span(const Span<Other> & other) noexcept
+		: data(other.getData()), itemCount(other.getCount())
+	{
+	}
+
+	// O(1), or whatever the container's getData() costs
+	template< typename Container, typename = decltype(stdlib::declval<ValueType * &>() = stdlib::declval<Container &>().getData()) >
+	constexpr Span(Container & container)
+		: data(container.getData()), itemCount(container.getCount())
+	{
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return (this->itemCount == 0);
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return this->itemCount;
+	}
+
+	// O(1)
+	// The view does not own its items, so constness is part of Type
+	constexpr ValueType * getData() const noexcept
+	{
+		return this->data;
+	}
+
+	// O(1)
+	constexpr ValueType & operator [](IndexType index) const
+	{
+		return this->data[index];
+	}
+
+	// O(1)
+	constexpr Iterator begin() const noexcept
+	{
+		return this->data;
+	}
+
+	// O(1)
+	constexpr Iterator end() const noexcept
+	{
+		return (this->data + this->itemCount);
+	}
+
+	// O(N)
+	bool contains(const ValueType & item) const
+	{
+		return (this->indexOfFirst(item) != InvalidIndex);
+	}
+
+	// O(N)
+	IndexOfType indexOfFirst(const ValueType & item) const
+	{
+		const ValueType * const result = stdlib::find(this->begin(), this->end(), item);
+		return (result != this->end()) ? (result - this->data) : InvalidIndex;
+	}
+
+	// O(N)
+	IndexOfType indexOfLast(const ValueType & item) const
+	{
+		const ValueType * const result = stdlib::find_last(this->begin(), this->end(), item);
+		return (result != this->end()) ? (result - this->data) : InvalidIndex;
+	}
+
+	// O(N)
+	SizeType count(const ValueType & item) const
+	{
+		return stdlib::count(this->begin(), this->end(), item);
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	constexpr ValueType & getFirst() const
+	{
+		return this->data[FirstIndex];
+	}
+
+	// O(1)
+	constexpr ValueType & getLast() const
+	{
+		return this->data[this->itemCount - 1];
+	}
+
+	// O(1)
+	// Up to count items starting at index, cut short at the end of this view
+	constexpr Span slice(IndexType index, SizeType count) const noexcept
+	{
+		return (index >= this->itemCount) ? Span(this->data + this->itemCount, 0) :
+			Span(this->data + index, (count < (this->itemCount - index)) ? count : (this->itemCount - index));
+	}
+
+	// O(1)
+	// Up to count items from the start
+	constexpr Span sliceFirst(SizeType count) const noexcept
+	{
+		return Span(this->data, (count < this->itemCount) ? count : this->itemCount);
+	}
+
+	// O(1)
+	// Up to count items from the end
+	constexpr Span sliceLast(SizeType count) const noexcept
+	{
+		return (count < this->itemCount) ? Span(this->data + (this->itemCount - count), count) : *this;
+	}
+};
+
+//
+// Helper Functions
+//
+
+// O(1)
+template< typename Type >
+constexpr Span<Type> makeSpan(Type * data, size_t count) noexcept
+{
+	return Span<Type>(data, count);
+}
+
+// O(1)
+// Spans the items of container, which may be const.
+// The item type comes from Container::ValueType, and getData() must point at items of it,
+// so a packed container such as Array<bool> is not accepted.
+template< typename Container, typename ItemType = stdlib::conditional_t<stdlib::is_const<Container>::value, const typename Container::ValueType, typename Container::ValueType>, typename = decltype(stdlib::declval<ItemType * &>() = stdlib::declval<Container &>().getData()) >
+Span<ItemType> makeSpan(Container & container)
+{
+	return Span<ItemType>(container);
+}
\ No newline at end of file
@@ -0,0 +1,399 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "Utility.h"
+#include "Algorithm.h"
+#include "IntegerTypes.h"
+#include "UninitialisedStorage.h"
+
+#if defined(__has_include)
+#if __has_include(<atomic>)
+#include <atomic>
+#define SPSC_QUEUE_HAS_ATOMIC
+#endif
+#endif
+
+//
+// Index Policies
+//
+
+// For an interrupt handler and the main loop on a single core.
+// The compiler barriers stop the item writes being reordered past the index writes.
+template< typename Type >
+class VolatileIndex
+{
+public:
+
+	//
+	// Constraints
+	//
+
+#if defined(__AVR__)
+	static_assert(sizeof(Type) == 1, "AVR can only read and write single bytes atomically, so the capacity must be no more than 255");
+#endif
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	volatile Type value = 0;
+
+public:
+
+	//
+	// Member Functions
+	//
+
+	// O(1)
+	Type loadRelaxed() const noexcept
+	{
+		return this->value;
+	}
+
+	// O(1)
+	Type loadAcquire() const noexcept
+	{
+		const Type result = this->value;
+		__asm__ __volatile__ ("" ::: "memory");
+		return result;
+	}
+
+	// O(1)
+	void storeRelease(Type value) noexcept
+	{
+		__asm__ __volatile__ ("" ::: "memory");
+		this->value = value;
+	}
+};
+
+#if defined(SPSC_QUEUE_HAS_ATOMIC)
+// For two threads.
+// Each index gets a cache line to itself so the producer and consumer don't contend.
+template< typename Type >
+class AtomicIndex
+{
+private:
+
+	//
+	// Member Variables
+	//
+
+	alignas(64) std::atomic<Type> value { 0 };
+
+public:
+
+	//
+	// Member Functions
+	//
+
+	// O(1)
+	Type loadRelaxed() const noexcept
+	{
+		return this->value.load(std::memory_order_relaxed);
+	}
+
+	// O(1)
+	Type loadAcquire() const noexcept
+	{
+		return this->value.load(std::memory_order_acquire);
+	}
+
+	// O(1)
+	void storeRelease(Type value) noexcept
+	{
+		this->value.store(value, std::memory_order_release);
+	}
+};
+#endif
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+class BasicSpscQueue;
+
+// Safe to use from an interrupt handler and the main loop
+template< typename Type, uintmax_t capactiy >
+using InterruptSafeQueue = BasicSpscQueue<Type, capactiy, VolatileIndex>;
+
+#if defined(SPSC_QUEUE_HAS_ATOMIC)
+// Safe to use from one producer thread and one consumer thread
+template< typename Type, uintmax_t capactiy >
+using SpscQueue = BasicSpscQueue<Type, capactiy, AtomicIndex>;
+#endif
+
+// Only the producer may call enqueue, emplace and enqueueRange.
+// Only the consumer may call peek, dequeue and dequeueInto.
+// The count is only a snapshot when called while the other side is active.
+template< typename Type, uintmax_t capactiyValue, template< typename > class Index >
+class BasicSpscQueue
+{
+public:
+
+	//
+	// Constraints
+	//
+
+	static_assert(capactiyValue > 0, "Attempt to create BasicSpscQueue with a capacity less than 1");
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+
+private:
+
+	//
+	// Constants
+	//
+
+	// One slot is always left empty so that a full queue can be told apart from an empty one
+	constexpr static const uintmax_t slotCount = (capactiyValue + 1);
+
+	//
+	// Member Variables
+	//
+
+	UninitialisedStorage<ValueType, slotCount> items;
+	Index<IndexType> head;
+	Index<IndexType> tail;
+
+	//
+	// Private Member Functions
+	//
+
+	// O(1)
+	static IndexType nextIndex(IndexType index) noexcept
+	{
+		return (index < capactiy) ? (index + 1) : 0;
+	}
+
+	// O(1)
+	static IndexType advanceIndex(IndexType index, SizeType amount) noexcept
+	{
+		return (amount < (slotCount - index)) ? (index + amount) : (amount - (slotCount - index));
+	}
+
+	// O(1)
+	static SizeType countBetween(IndexType head, IndexType tail) noexcept
+	{
+		return (tail >= head) ? (tail - head) : (tail + (slotCount - head));
+	}
+
+public:
+
+	//
+	// Constructors, Destructor and Assignment
+	//
+
+	BasicSpscQueue() = default;
+
+	BasicSpscQueue(const BasicSpscQueue &) = delete;
+
+	BasicSpscQueue & operator =(const BasicSpscQueue &) = delete;
+
+	// O(N)
+	// Must not be destroyed while either side is still in use
+	~BasicSpscQueue();
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	bool isEmpty() const noexcept
+	{
+		return (this->head.loadAcquire() == this->tail.loadAcquire());
+	}
+
+	// O(1)
+	bool isFull() const noexcept
+	{
+		return (this->getCount() == capactiy);
+	}
+
+	// O(1)
+	SizeType getCount() const noexcept
+	{
+		return countBetween(this->head.loadAcquire(), this->tail.loadAcquire());
+	}
+
+	// O(1)
+	constexpr SizeType getCapacity() const noexcept
+	{
+		return capactiy;
+	}
+
+public:
+
+	//
+	// Producer Member Functions
+	//
+
+	// O(1)
+	bool enqueue(const ValueType & item)
+	{
+		return this->emplace(item);
+	}
+
+	// O(1)
+	bool enqueue(ValueType && item)
+	{
+		return this->emplace(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments);
+
+	// O(N)
+	// Enqueues as many items as will fit, returns the number enqueued
+	SizeType enqueueRange(const ValueType * source, SizeType count);
+
+public:
+
+	//
+	// Consumer Member Functions
+	//
+
+	// O(1)
+	// Return result is undefined if queue is empty
+	ValueType & peek()
+	{
+		return this->items[this->head.loadRelaxed()];
+	}
+
+	// O(1)
+	// Return result is undefined if queue is empty
+	const ValueType & peek() const
+	{
+		return this->items[this->head.loadRelaxed()];
+	}
+
+	// O(1)
+	void dequeue();
+
+	// O(N)
+	// Moves up to count items out of the queue into destination, in the order they were enqueued,
+	// returns the number moved
+	SizeType dequeueInto(ValueType * destination, SizeType count);
+};
+
+//
+// Definition
+//
+
+// O(N)
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+BasicSpscQueue<Type, capactiy, Index>::~BasicSpscQueue()
+{
+	const IndexType tail = this->tail.loadAcquire();
+
+	for (IndexType index = this->head.loadRelaxed(); index != tail; index = nextIndex(index))
+		this->items.destroy(index);
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+template< typename ... Arguments >
+bool BasicSpscQueue<Type, capactiy, Index>::emplace(Arguments && ... arguments)
+{
+	const IndexType tail = this->tail.loadRelaxed();
+	const IndexType next = nextIndex(tail);
+
+	if (next == this->head.loadAcquire())
+		return false;
+
+	this->items.construct(tail, stdlib::forward<Arguments>(arguments)...);
+	this->tail.storeRelease(next);
+	return true;
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+auto BasicSpscQueue<Type, capactiy, Index>::enqueueRange(const ValueType * source, SizeType count) -> SizeType
+{
+	const IndexType tail = this->tail.loadRelaxed();
+	const SizeType space = (capactiy - countBetween(this->head.loadAcquire(), tail));
+	const SizeType amount = (count < space) ? count : space;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const SizeType firstRun = (amount < (slotCount - tail)) ? amount : static_cast<SizeType>(slotCount - tail);
+
+	stdlib::uninitialized_copy(source, source + firstRun, data + tail);
+	stdlib::uninitialized_copy(source + firstRun, source + amount, data);
+
+	this->tail.storeRelease(advanceIndex(tail, amount));
+	return amount;
+}
+
+// O(1)
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+void BasicSpscQueue<Type, capactiy, Index>::dequeue()
+{
+	const IndexType head = this->head.loadRelaxed();
+
+	if (head == this->tail.loadAcquire())
+		return;
+
+	this->items.destroy(head);
+	this->head.storeRelease(nextIndex(head));
+}
+
+// O(N)
+template< typename Type, uintmax_t capactiy, template< typename > class Index >
+auto BasicSpscQueue<Type, capactiy, Index>::dequeueInto(ValueType * destination, SizeType count) -> SizeType
+{
+	const IndexType head = this->head.loadRelaxed();
+	const SizeType available = countBetween(head, this->tail.loadAcquire());
+	const SizeType amount = (count < available) ? count : available;
+
+	if (amount == 0)
+		return 0;
+
+	ValueType * const data = this->items.getData();
+	const SizeType firstRun = (amount < (slotCount - head)) ? amount : static_cast<SizeType>(slotCount - head);
+
+	stdlib::move(data + head, data + head + firstRun, destination);
+	stdlib::move(data, data + (amount - firstRun), destination + firstRun);
+
+	stdlib::destroy(data + head, data + head + firstRun);
+	stdlib::destroy(data, data + (amount - firstRun));
+
+	this->head.storeRelease(advanceIndex(head, amount));
+	return amount;
+}
\ No newline at end of file
@@ -24,10 +24,10 @@
 // Declarations
 //
 
-template< typename Type, uint8_t capactiy, typename Container = Deque<Type, capactiy> >
+template< typename Type, uintmax_t capactiy, typename Container = Deque<Type, capactiy> >
 class Stack;
 
-template< typename Type, uint8_t capactiyValue, typename Container >
+template< typename Type, uintmax_t capactiyValue, typename Container >
 class Stack
 {
 public:
@@ -37,7 +37,6 @@ public:
 	//
 
 	//static_assert(capactiyValue > 0, "Attempt to create Stack with a capacity less than 1");
-	static_assert(capactiyValue < 128, "Attempt to create Stack with a capacity greater than 127");
 
 	//
 	// Type Aliases
@@ -48,6 +47,8 @@ public:
 	using SizeType = typename ContainerType::SizeType;
 	using IndexType = typename ContainerType::IndexType;
 	using IndexOfType = typename ContainerType::IndexOfType;
+	using Iterator = typename ContainerType::Iterator;
+	using ConstIterator = typename ContainerType::ConstIterator;
 	
 	//
 	// Constants
@@ -120,6 +121,31 @@ public:
 		return this->container[index];
 	}
 	
+	// O(1)
+	// Goes from the bottom of the stack to the top
+	Iterator begin()
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	ConstIterator begin() const
+	{
+		return this->container.begin();
+	}
+
+	// O(1)
+	Iterator end()
+	{
+		return this->container.end();
+	}
+
+	// O(1)
+	ConstIterator end() const
+	{
+		return this->container.end();
+	}
+	
 	// O(N)
 	void clear()
 	{
@@ -149,6 +175,12 @@ public:
 	{
 		return this->container.indexOfFirst(item);
 	}
+
+	// O(N)
+	SizeType count(const ValueType & item) const
+	{
+		return this->container.count(item);
+	}
 	
 public:
 
@@ -174,11 +206,46 @@ public:
 		return this->container.append(item);
 	}
 
+	// O(1)
+	bool push(ValueType && item)
+	{
+		return this->container.append(stdlib::move(item));
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	bool emplace(Arguments && ... arguments)
+	{
+		return this->container.emplaceBack(stdlib::forward<Arguments>(arguments)...);
+	}
+
+	// O(N)
+	// Pushes as many items as will fit, returns the number pushed
+	SizeType pushRange(const ValueType * source, SizeType count)
+	{
+		return this->container.appendRange(source, count);
+	}
+
+	// O(N)
+	template< typename OtherContainer >
+	SizeType pushRange(const OtherContainer & container)
+	{
+		return this->container.appendRange(container);
+	}
+
 	// O(1)
 	void drop()
 	{
 		this->container.unappend();
 	}
+
+	// O(N)
+	// Moves up to count items off the stack into destination, returns the number moved.
+	// The items keep the order they were pushed in, so the top of the stack ends up last.
+	SizeType popInto(ValueType * destination, SizeType count)
+	{
+		return this->container.unappendInto(destination, count);
+	}
 	
 	// O(N)
 	bool removeFirst(const ValueType & item)
@@ -203,4 +270,17 @@ public:
 	{
 		return this->container.insert(index, item);
 	}
+
+	// O(N)
+	bool insert(const IndexType & index, ValueType && item)
+	{
+		return this->container.insert(index, stdlib::move(item));
+	}
+
+	// O(N)
+	template< typename ... Arguments >
+	bool emplaceAt(const IndexType & index, Arguments && ... arguments)
+	{
+		return this->container.emplaceAt(index, stdlib::forward<Arguments>(arguments)...);
+	}
 };
\ No newline at end of file
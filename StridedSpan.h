@@ -0,0 +1,198 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TypeTraits.h"
+
+//
+// Declarations
+//
+
+template< typename Type >
+class StridedSpan;
+
+// A view of count items that belong to something else,
+// each one stride items after the one before, such as a column of a Grid.
+// Use StridedSpan<const Type> for a read only view.
+// Like a Span, it is only valid for as long as the items it views stay where they are.
+template< typename Type >
+class StridedSpan
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = size_t;
+	using IndexType = size_t;
+
+	// Counts down instead of comparing pointers,
+	// so it never steps more than one item past the last
+	class Iterator
+	{
+	private:
+		ValueType * item;
+		SizeType stride;
+		SizeType remaining;
+
+	public:
+		Iterator(ValueType * item, SizeType stride, SizeType remaining) noexcept
+			: item(item), stride(stride), remaining(remaining)
+		{
+		}
+
+		ValueType & operator *() const noexcept
+		{
+			return *this->item;
+		}
+
+		ValueType * operator ->() const noexcept
+		{
+			return this->item;
+		}
+
+		Iterator & operator ++() noexcept
+		{
+			--this->remaining;
+
+			if (this->remaining > 0)
+				this->item += this->stride;
+
+			return *this;
+		}
+
+		Iterator operator ++(int) noexcept
+		{
+			const Iterator result = *this;
+			++*this;
+			return result;
+		}
+
+		bool operator ==(const Iterator & other) const noexcept
+		{
+			return (this->remaining == other.remaining);
+		}
+
+		bool operator !=(const Iterator & other) const noexcept
+		{
+			return (this->remaining != other.remaining);
+		}
+	};
+
+	using ConstIterator = Iterator;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	ValueType * data = nullptr;
+	SizeType itemCount = 0;
+	SizeType stride = 1;
+
+public:
+
+	//
+	// Constructors
+	//
+
+	// O(1)
+	constexpr StridedSpan() noexcept = default;
+
+	// O(1)
+	constexpr StridedSpan(ValueType * data, SizeType count, SizeType stride) noexcept
+		: data(data), itemCount(count), stride(stride)
+	{
+	}
+
+	// O(1)
+	// Converts a StridedSpan<Type> to a StridedSpan<const Type>
+	template< typename Other, typename = decltype(stdlib::declval<ValueType * &>() = stdlib::declval<Other *>()) >
+	constexpr StridedSpan(const StridedSpan<Other> & other) noexcept
+		: data(other.getData()), itemCount(other.getCount()), stride(other.getStride())
+	{
+	}
+
+public:
+
+	//
+	// Common Member Functions
+	//
+
+	// O(1)
+	constexpr bool isEmpty() const noexcept
+	{
+		return (this->itemCount == 0);
+	}
+
+	// O(1)
+	constexpr SizeType getCount() const noexcept
+	{
+		return this->itemCount;
+	}
+
+	// O(1)
+	// The first item
+	constexpr ValueType * getData() const noexcept
+	{
+		return this->data;
+	}
+
+	// O(1)
+	constexpr ValueType & operator [](IndexType index) const
+	{
+		return this->data[index * this->stride];
+	}
+
+	// O(1)
+	Iterator begin() const noexcept
+	{
+		return Iterator(this->data, this->stride, this->itemCount);
+	}
+
+	// O(1)
+	Iterator end() const noexcept
+	{
+		return Iterator(this->data, this->stride, 0);
+	}
+
+	// O(N)
+	void fill(const ValueType & value) const
+	{
+		for (ValueType & item : *this)
+			item = value;
+	}
+
+public:
+
+	//
+	// Specific Member Functions
+	//
+
+	// O(1)
+	// The distance in items from one item to the next
+	constexpr SizeType getStride() const noexcept
+	{
+		return this->stride;
+	}
+};
\ No newline at end of file
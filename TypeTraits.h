@@ -27,6 +27,22 @@ namespace std
 }
 #endif
 
+// Before C++14, constexpr functions can't contain loops or assignments,
+// so functions that need them are only constexpr where the language allows
+#if (__cpp_constexpr >= 201304L)
+#define STDLIB_CONSTEXPR14 constexpr
+#else
+#define STDLIB_CONSTEXPR14
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define STDLIB_HAS_IS_CONSTANT_EVALUATED
+#endif
+#elif defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9)
+#define STDLIB_HAS_IS_CONSTANT_EVALUATED
+#endif
+
 namespace stdlib
 {
 
@@ -303,6 +319,12 @@ namespace stdlib
 	template< typename T,unsigned N = 0 >
 	struct extent;
 
+	template< typename T >
+	struct is_trivially_copyable;
+
+	template< typename T >
+	struct is_trivially_destructible;
+
 	//
 	// Special Purpose
 	//
@@ -316,6 +338,11 @@ namespace stdlib
 	template< typename ... T >
 	struct common_type;
 
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+	// Since C++20
+	constexpr bool is_constant_evaluated() noexcept;
+#endif
+
 	//
 	// Special Purpose Aliases
 	//
@@ -341,6 +368,12 @@ namespace stdlib
 	// Since C++17
 	//template< typename T, unsigned N = 0 > inline constexpr decltype(sizeof(0)) extent_v = extent<T, N>::value;
 
+	// Since C++17
+	//template< typename T > inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+
+	// Since C++17
+	//template< typename T > inline constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
+
 	//
 	// Type Categories
 	//
@@ -796,6 +829,19 @@ namespace stdlib
 	template< typename T, decltype(sizeof(0)) I , unsigned N >
 	struct extent<T[I], N> : extent<T, N-1> {};
 
+
+	// These can't be written in portable C++, so they rely on compiler intrinsics
+	template< typename T >
+	struct is_trivially_copyable : bool_constant<__is_trivially_copyable(T)> {};
+
+#if defined(__clang__)
+	template< typename T >
+	struct is_trivially_destructible : bool_constant<__is_trivially_destructible(T)> {};
+#else
+	template< typename T >
+	struct is_trivially_destructible : bool_constant<__has_trivial_destructor(T)> {};
+#endif
+
 	//
 	// Special Purpose
 	//
@@ -822,6 +868,13 @@ namespace stdlib
 	template< typename T, typename U, typename ... Ts >
 	struct common_type<T, U, Ts...> : conditional_t<(is_void<void_t<common_type_t<T, U>>>::value), common_type<common_type_t<T, U>, Ts ...>, common_type<>> {};
 
+#if defined(STDLIB_HAS_IS_CONSTANT_EVALUATED)
+	constexpr bool is_constant_evaluated() noexcept
+	{
+		return __builtin_is_constant_evaluated();
+	}
+#endif
+
 
 	//
 	// Type Categories
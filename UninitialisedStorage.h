@@ -0,0 +1,104 @@
+#pragma once
+
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+#include <new>
+
+#include "Utility.h"
+#include "IntegerTypes.h"
+
+//
+// Declarations
+//
+
+template< typename Type, uintmax_t capactiy >
+class UninitialisedStorage;
+
+// Suitably aligned space for up to capactiy objects.
+// Nothing is constructed or destroyed unless asked,
+// so the owner must keep track of which slots are alive.
+template< typename Type, uintmax_t capactiyValue >
+class UninitialisedStorage
+{
+public:
+
+	//
+	// Type Aliases
+	//
+
+	using ValueType = Type;
+	using SizeType = SmallestUnsignedType<capactiyValue>;
+	using IndexType = SizeType;
+
+	//
+	// Constants
+	//
+
+	constexpr static const SizeType capactiy = capactiyValue;
+
+private:
+
+	//
+	// Member Variables
+	//
+
+	alignas(ValueType) unsigned char bytes[sizeof(ValueType) * capactiy];
+
+public:
+
+	//
+	// Member Functions
+	//
+
+	// O(1)
+	ValueType * getData() noexcept
+	{
+		return reinterpret_cast<ValueType *>(&this->bytes[0]);
+	}
+
+	// O(1)
+	const ValueType * getData() const noexcept
+	{
+		return reinterpret_cast<const ValueType *>(&this->bytes[0]);
+	}
+
+	// O(1)
+	ValueType & operator [](IndexType index)
+	{
+		return this->getData()[index];
+	}
+
+	// O(1)
+	const ValueType & operator [](IndexType index) const
+	{
+		return this->getData()[index];
+	}
+
+	// O(1)
+	template< typename ... Arguments >
+	void construct(IndexType index, Arguments && ... arguments)
+	{
+		::new (static_cast<void *>(&this->getData()[index])) ValueType(stdlib::forward<Arguments>(arguments)...);
+	}
+
+	// O(1)
+	void destroy(IndexType index)
+	{
+		this->getData()[index].~ValueType();
+	}
+};
\ No newline at end of file
@@ -87,16 +87,16 @@ namespace stdlib
 	template< typename Type >
 	void swap(Type & a, Type & b)
 	{
-		Type c = move(a);
-		a = move(b);
-		b = move(c);
+		Type c = stdlib::move(a);
+		a = stdlib::move(b);
+		b = stdlib::move(c);
 	}
 
 	template< typename Type, decltype(sizeof(0)) size >
 	void swap(Type (&a)[size], Type (&b)[size]) noexcept(noexcept(swap(*a, *b)))
 	{
 		for(decltype(sizeof(0)) i = 0; i < size; ++i)
-			swap(a[i], b[i]);
+			stdlib::swap(a[i], b[i]);
 	}
 
 	template< typename Type >
@@ -124,8 +124,8 @@ namespace stdlib
 	template<typename Type, typename ValueType >
 	Type exchange(Type & object, ValueType && new_value)
 	{
-		Type old_value = move(object);
-		objetc = forward<ValueType>(new_value);
+		Type old_value = stdlib::move(object);
+		object = stdlib::forward<ValueType>(new_value);
 		return old_value;
 	}
 
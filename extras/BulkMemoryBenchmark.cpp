@@ -0,0 +1,162 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only benchmark for the bulk memory paths of Deque, Array and Grid.
+// Each operation is timed on uint8_t and int items, which take the memmove and memset paths,
+// and on a wrapper with a hand written copy, which is not trivially copyable
+// and so takes the element by element loops instead.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -I. extras/BulkMemoryBenchmark.cpp -o BulkMemoryBenchmark
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+#include "Deque.h"
+#include "Array.h"
+#include "Grid.h"
+
+constexpr uint32_t dequeCapacity = 1024;
+constexpr uint32_t dequeRepeats = 100000;
+constexpr uint32_t fillRepeats = 100000;
+
+// The same item with a copy the compiler can't treat as trivial
+template< typename Type >
+struct Looped
+{
+	Type value;
+
+	Looped() = default;
+
+	Looped(Type value)
+		: value(value)
+	{
+	}
+
+	Looped(const Looped & other)
+		: value(other.value)
+	{
+	}
+
+	Looped & operator =(const Looped & other)
+	{
+		this->value = other.value;
+		return *this;
+	}
+};
+
+template< typename Type >
+uint32_t valueOf(const Type & item)
+{
+	return static_cast<uint32_t>(item);
+}
+
+template< typename Type >
+uint32_t valueOf(const Looped<Type> & item)
+{
+	return static_cast<uint32_t>(item.value);
+}
+
+// Stops the compiler dropping work whose result is never read
+volatile uint32_t sink;
+
+// Removes the first item and puts it back, shifting every other item twice
+template< typename Item >
+void runRemoveInsert()
+{
+	static Deque<Item, dequeCapacity> deque;
+
+	while (deque.append(Item(1)))
+		continue;
+
+	for (uint32_t repeat = 0; repeat < dequeRepeats; ++repeat)
+	{
+		deque.removeAt(0);
+		deque.insert(0, Item(static_cast<uint8_t>(repeat)));
+	}
+
+	sink = valueOf(deque[0]);
+}
+
+// Pushes onto the front and takes it off again, shifting every other item twice
+template< typename Item >
+void runPrependUnprepend()
+{
+	static Deque<Item, dequeCapacity> deque;
+
+	while (deque.getCount() < (dequeCapacity - 1))
+		deque.append(Item(1));
+
+	for (uint32_t repeat = 0; repeat < dequeRepeats; ++repeat)
+	{
+		deque.prepend(Item(static_cast<uint8_t>(repeat)));
+		sink = valueOf(deque[0]);
+		deque.unprepend();
+	}
+}
+
+template< typename Item >
+void runArrayFill()
+{
+	static Array<Item, 4096> array;
+
+	for (uint32_t repeat = 0; repeat < fillRepeats; ++repeat)
+	{
+		array.fill(Item(static_cast<uint8_t>(repeat)));
+		sink = valueOf(array[repeat % 4096]);
+	}
+}
+
+template< typename Item >
+void runGridFill()
+{
+	static Grid<Item, 128, 64> grid;
+
+	for (uint32_t repeat = 0; repeat < fillRepeats; ++repeat)
+	{
+		grid.fill(Item(static_cast<uint8_t>(repeat)));
+		sink = valueOf(grid.getItem(repeat % 128, repeat % 64));
+	}
+}
+
+template< typename Function >
+double measure(Function function, uint32_t repeats)
+{
+	const auto start = std::chrono::steady_clock::now();
+	function();
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / repeats;
+}
+
+template< typename Type >
+void report(const char * name)
+{
+	printf("%s\n", name);
+	printf("  %-40s %10.1f ns %10.1f ns\n", "Deque 1024, removeAt(0) + insert(0)", measure(runRemoveInsert<Type>, dequeRepeats), measure(runRemoveInsert<Looped<Type>>, dequeRepeats));
+	printf("  %-40s %10.1f ns %10.1f ns\n", "Deque 1023, prepend + unprepend", measure(runPrependUnprepend<Type>, dequeRepeats), measure(runPrependUnprepend<Looped<Type>>, dequeRepeats));
+	printf("  %-40s %10.1f ns %10.1f ns\n", "Array 4096, fill", measure(runArrayFill<Type>, fillRepeats), measure(runArrayFill<Looped<Type>>, fillRepeats));
+	printf("  %-40s %10.1f ns %10.1f ns\n", "Grid 128x64, fill", measure(runGridFill<Type>, fillRepeats), measure(runGridFill<Looped<Type>>, fillRepeats));
+}
+
+int main()
+{
+	printf("  %-40s %13s %13s\n", "Per operation", "bulk memory", "item by item");
+
+	report<uint8_t>("uint8_t");
+	report<int>("int");
+}
@@ -0,0 +1,145 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only benchmark of a 3x3 stencil over a Grid with each layout from GridLayout.h.
+// Every pass sums the 3x3 block around each inner cell of one grid into another, three ways:
+// through getItem, through the step functions in row order,
+// and through the step functions in a shuffled order, where the layout's locality matters most.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -I. extras/GridLayoutBenchmark.cpp -o GridLayoutBenchmark
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "Grid.h"
+#include "GridLayout.h"
+
+template< typename GridType >
+void sumByGetItem(const GridType & source, GridType & target, uintmax_t size)
+{
+	for (uintmax_t y = 1; y < (size - 1); ++y)
+		for (uintmax_t x = 1; x < (size - 1); ++x)
+		{
+			uint32_t sum = 0;
+
+			for (uintmax_t offsetY = 0; offsetY < 3; ++offsetY)
+				for (uintmax_t offsetX = 0; offsetX < 3; ++offsetX)
+					sum += source.getItem(x + offsetX - 1, y + offsetY - 1);
+
+			target.getItem(x, y) = sum;
+		}
+}
+
+template< typename GridType >
+void sumCell(const GridType & source, GridType & target, typename GridType::IndexType centre)
+{
+	const auto above = GridType::stepUp(centre);
+	const auto below = GridType::stepDown(centre);
+
+	target[centre] =
+		source[GridType::stepLeft(above)] + source[above] + source[GridType::stepRight(above)] +
+		source[GridType::stepLeft(centre)] + source[centre] + source[GridType::stepRight(centre)] +
+		source[GridType::stepLeft(below)] + source[below] + source[GridType::stepRight(below)];
+}
+
+template< typename GridType >
+void sumByStep(const GridType & source, GridType & target, uintmax_t size)
+{
+	for (uintmax_t y = 1; y < (size - 1); ++y)
+		for (uintmax_t x = 1; x < (size - 1); ++x)
+			sumCell(source, target, GridType::getIndex(x, y));
+}
+
+template< typename GridType >
+void sumByStepShuffled(const GridType & source, GridType & target, const uint32_t * order, uintmax_t size)
+{
+	const uintmax_t inner = (size - 2);
+
+	for (uintmax_t index = 0; index < (inner * inner); ++index)
+		sumCell(source, target, GridType::getIndex(1 + (order[index] % inner), 1 + (order[index] / inner)));
+}
+
+template< typename Function >
+double measure(Function function, uint32_t passes)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t pass = 0; pass < passes; ++pass)
+	{
+		function();
+
+		// Keeps each pass from being merged with the next or dropped
+		asm volatile("" ::: "memory");
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() / passes;
+}
+
+template< uintmax_t size, typename Layout >
+void report(const char * name, const uint32_t * order, uint32_t passes)
+{
+	using GridType = Grid<uint32_t, size, size, Layout>;
+
+	static GridType source;
+	static GridType target;
+
+	std::mt19937 random(1);
+
+	for (uintmax_t y = 0; y < size; ++y)
+		for (uintmax_t x = 0; x < size; ++x)
+			source.getItem(x, y) = (random() & 0xFF);
+
+	const double byGetItem = measure([&]() { sumByGetItem(source, target, size); }, passes);
+	const double byStep = measure([&]() { sumByStep(source, target, size); }, passes);
+	const double byStepShuffled = measure([&]() { sumByStepShuffled(source, target, order, size); }, passes);
+
+	printf("  %-12s %12.1f us %12.1f us %12.1f us\n", name, byGetItem, byStep, byStepShuffled);
+}
+
+template< uintmax_t size >
+void reportAll(uint32_t passes)
+{
+	constexpr uintmax_t inner = (size - 2);
+
+	static uint32_t order[inner * inner];
+
+	for (uint32_t index = 0; index < (inner * inner); ++index)
+		order[index] = index;
+
+	std::shuffle(&order[0], &order[inner * inner], std::mt19937(2));
+
+	printf("%ux%u uint32_t, per pass\n", static_cast<unsigned>(size), static_cast<unsigned>(size));
+	printf("  %-12s %15s %15s %15s\n", "Layout", "getItem", "step", "step shuffled");
+
+	report<size, RowMajorLayout>("row major", order, passes);
+	report<size, MortonLayout>("morton", order, passes);
+	report<size, TiledLayout<8>>("tiled 8", order, passes);
+	report<size, TiledLayout<16>>("tiled 16", order, passes);
+}
+
+int main()
+{
+	reportAll<256>(200);
+
+	// Big enough that the grid no longer fits in cache
+	reportAll<2048>(3);
+}
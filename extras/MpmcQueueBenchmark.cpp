@@ -0,0 +1,137 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only contention benchmark for MpmcQueue,
+// with 1, 2, 4 and 8 producer threads and as many consumer threads.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -pthread -I. extras/MpmcQueueBenchmark.cpp -o MpmcQueueBenchmark
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "MpmcQueue.h"
+#include "Queue.h"
+
+constexpr uint32_t itemCount = 4000000;
+
+// Wraps a Queue in a std::mutex, for comparison
+class LockedQueue
+{
+private:
+	Queue<uint32_t, 1024> queue;
+	std::mutex mutex;
+
+public:
+	bool enqueue(uint32_t item)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->queue.enqueue(item);
+	}
+
+	bool dequeue(uint32_t & destination)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->queue.isEmpty())
+			return false;
+
+		destination = this->queue.peek();
+		this->queue.dequeue();
+		return true;
+	}
+};
+
+// Each producer enqueues its share of 0 to itemCount - 1,
+// and the consumers take items until all of them have been taken.
+// Returns the sum of the items taken.
+template< typename QueueType >
+uint64_t run(QueueType & queue, uint32_t threadCount)
+{
+	std::atomic<uint32_t> taken(0);
+	std::atomic<uint64_t> sum(0);
+	std::vector<std::thread> threads;
+
+	for (uint32_t producer = 0; producer < threadCount; ++producer)
+		threads.emplace_back([&queue, producer, threadCount]()
+		{
+			for (uint32_t item = producer; item < itemCount; item += threadCount)
+				while (!queue.enqueue(item))
+					std::this_thread::yield();
+		});
+
+	for (uint32_t consumer = 0; consumer < threadCount; ++consumer)
+		threads.emplace_back([&queue, &taken, &sum]()
+		{
+			uint64_t localSum = 0;
+			uint32_t item;
+
+			while (taken.load(std::memory_order_relaxed) < itemCount)
+			{
+				if (queue.dequeue(item))
+				{
+					localSum += item;
+					taken.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			sum.fetch_add(localSum);
+		});
+
+	for (std::thread & thread : threads)
+		thread.join();
+
+	return sum.load();
+}
+
+template< typename QueueType >
+double measure(uint32_t threadCount, bool & correct)
+{
+	static QueueType queue;
+
+	const auto start = std::chrono::steady_clock::now();
+	const uint64_t sum = run(queue, threadCount);
+	const auto end = std::chrono::steady_clock::now();
+
+	correct = (sum == ((static_cast<uint64_t>(itemCount) * (itemCount - 1)) / 2));
+	return ((itemCount / std::chrono::duration<double>(end - start).count()) / 1000000.0);
+}
+
+int main()
+{
+	printf("%u hardware threads\n", std::thread::hardware_concurrency());
+	printf("producers  MpmcQueue  Queue with std::mutex  (million items/s)\n");
+
+	for (uint32_t threadCount = 1; threadCount <= 8; threadCount *= 2)
+	{
+		bool lockFreeCorrect;
+		bool lockedCorrect;
+
+		const double lockFree = measure<MpmcQueue<uint32_t, 1024>>(threadCount, lockFreeCorrect);
+		const double locked = measure<LockedQueue>(threadCount, lockedCorrect);
+
+		printf("%9u  %9.1f  %21.1f%s\n", threadCount, lockFree, locked, (lockFreeCorrect && lockedCorrect) ? "" : "  (wrong sum)");
+	}
+}
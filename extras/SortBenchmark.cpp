@@ -0,0 +1,104 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only benchmark for sort from ContainerAlgorithms.h against std::sort.
+// Arrays of 16 items or fewer take the sorting networks, larger ones the introsort.
+// Every run sorts the same shuffled copies with both.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -I. extras/SortBenchmark.cpp -o SortBenchmark
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "ContainerAlgorithms.h"
+
+constexpr uint32_t itemsPerSize = 4000000;
+
+template< typename Type, uintmax_t count >
+void report(const char * name)
+{
+	using ArrayType = Array<Type, count>;
+
+	// Enough copies to sort about the same number of items at every size
+	constexpr uint32_t copies = ((itemsPerSize / count) < 1) ? 1 : (itemsPerSize / count);
+	constexpr uint32_t batch = (copies < 256) ? copies : 256;
+
+	static ArrayType source[batch];
+	static ArrayType items[batch];
+	static ArrayType expected[batch];
+
+	std::mt19937 random(count);
+
+	for (auto & array : source)
+		for (uint32_t index = 0; index < count; ++index)
+			array[index] = static_cast<Type>(random());
+
+	double librarySeconds = 0;
+	double standardSeconds = 0;
+	bool same = true;
+
+	constexpr uint32_t rounds = (copies / batch);
+
+	for (uint32_t round = 0; round < rounds; ++round)
+	{
+		std::copy(&source[0], &source[batch], &items[0]);
+
+		const auto libraryStart = std::chrono::steady_clock::now();
+
+		for (auto & array : items)
+			sort(array);
+
+		const auto libraryEnd = std::chrono::steady_clock::now();
+
+		std::copy(&source[0], &source[batch], &expected[0]);
+
+		const auto standardStart = std::chrono::steady_clock::now();
+
+		for (auto & array : expected)
+			std::sort(array.begin(), array.end());
+
+		const auto standardEnd = std::chrono::steady_clock::now();
+
+		librarySeconds += std::chrono::duration<double>(libraryEnd - libraryStart).count();
+		standardSeconds += std::chrono::duration<double>(standardEnd - standardStart).count();
+
+		for (uint32_t copy = 0; copy < batch; ++copy)
+			same = (same && std::equal(items[copy].begin(), items[copy].end(), expected[copy].begin()));
+	}
+
+	const double sorted = (static_cast<double>(rounds) * batch);
+	printf("  %-22s %10.1f ns %10.1f ns %8.2fx%s\n", name, (librarySeconds / sorted) * 1e9, (standardSeconds / sorted) * 1e9, (standardSeconds / librarySeconds), same ? "" : "  (different result)");
+}
+
+int main()
+{
+	printf("  %-22s %13s %13s %9s\n", "Per sort", "sort", "std::sort", "speedup");
+
+	report<int32_t, 4>("int32_t x 4");
+	report<int32_t, 8>("int32_t x 8");
+	report<int32_t, 16>("int32_t x 16");
+	report<int32_t, 64>("int32_t x 64");
+	report<int32_t, 1000>("int32_t x 1000");
+	report<int32_t, 10000>("int32_t x 10000");
+
+	report<uint8_t, 8>("uint8_t x 8");
+	report<uint8_t, 16>("uint8_t x 16");
+	report<uint8_t, 1000>("uint8_t x 1000");
+}
@@ -0,0 +1,182 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only throughput benchmark for SpscQueue, one producer thread and one consumer thread.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -pthread -I. extras/SpscQueueBenchmark.cpp -o SpscQueueBenchmark
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "SpscQueue.h"
+#include "Queue.h"
+
+constexpr uint32_t itemCount = 10000000;
+constexpr uint32_t batchSize = 64;
+
+using ItemQueue = SpscQueue<uint32_t, 1024>;
+
+// Producer and consumer each take one item at a time
+uint64_t runSingle()
+{
+	static ItemQueue queue;
+	uint64_t sum = 0;
+
+	std::thread producer([]()
+	{
+		for (uint32_t item = 0; item < itemCount; ++item)
+			while (!queue.enqueue(item))
+				std::this_thread::yield();
+	});
+
+	for (uint32_t received = 0; received < itemCount; ++received)
+	{
+		while (queue.isEmpty())
+			std::this_thread::yield();
+
+		sum += queue.peek();
+		queue.dequeue();
+	}
+
+	producer.join();
+	return sum;
+}
+
+// Producer and consumer each move up to batchSize items at a time
+uint64_t runRange()
+{
+	static ItemQueue queue;
+	uint64_t sum = 0;
+
+	std::thread producer([]()
+	{
+		uint32_t items[batchSize];
+
+		for (uint32_t next = 0; next < itemCount;)
+		{
+			const uint32_t count = ((itemCount - next) < batchSize) ? (itemCount - next) : batchSize;
+
+			for (uint32_t index = 0; index < count; ++index)
+				items[index] = (next + index);
+
+			uint32_t sent = 0;
+
+			while (sent < count)
+			{
+				const uint32_t amount = queue.enqueueRange(&items[sent], static_cast<ItemQueue::SizeType>(count - sent));
+
+				if (amount == 0)
+					std::this_thread::yield();
+
+				sent += amount;
+			}
+
+			next += count;
+		}
+	});
+
+	uint32_t items[batchSize];
+
+	for (uint32_t received = 0; received < itemCount;)
+	{
+		const uint32_t amount = queue.dequeueInto(items, batchSize);
+
+		if (amount == 0)
+			std::this_thread::yield();
+
+		for (uint32_t index = 0; index < amount; ++index)
+			sum += items[index];
+
+		received += amount;
+	}
+
+	producer.join();
+	return sum;
+}
+
+// The same exchange through a Queue guarded by a mutex, for comparison
+uint64_t runLocked()
+{
+	static Queue<uint32_t, 1024> queue;
+	static std::mutex mutex;
+	uint64_t sum = 0;
+
+	std::thread producer([]()
+	{
+		for (uint32_t item = 0; item < itemCount;)
+		{
+			bool sent;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				sent = queue.enqueue(item);
+			}
+
+			if (sent)
+				++item;
+			else
+				std::this_thread::yield();
+		}
+	});
+
+	for (uint32_t received = 0; received < itemCount;)
+	{
+		bool taken = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (!queue.isEmpty())
+			{
+				sum += queue.peek();
+				queue.dequeue();
+				taken = true;
+			}
+		}
+
+		if (taken)
+			++received;
+		else
+			std::this_thread::yield();
+	}
+
+	producer.join();
+	return sum;
+}
+
+template< typename Function >
+void report(const char * name, Function function)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const uint64_t sum = function();
+	const auto end = std::chrono::steady_clock::now();
+
+	const double seconds = std::chrono::duration<double>(end - start).count();
+	const uint64_t expected = ((static_cast<uint64_t>(itemCount) * (itemCount - 1)) / 2);
+
+	printf("%-24s %8.1f million items/s%s\n", name, (itemCount / seconds) / 1000000.0, (sum == expected) ? "" : "  (wrong sum)");
+}
+
+int main()
+{
+	printf("%u hardware threads\n", std::thread::hardware_concurrency());
+
+	report("SpscQueue, single", runSingle);
+	report("SpscQueue, ranges of 64", runRange);
+	report("Queue with std::mutex", runLocked);
+}
@@ -0,0 +1,112 @@
+//
+//  Copyright (C) 2018-2019 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Host only benchmark for the vectorised searches behind
+// contains, indexOfFirst, indexOfLast, count and indexOfAny,
+// against the plain loops they fall back to.
+// Every search scans a whole Array of 4096 items.
+// Build from the library folder with:
+//   g++ -std=gnu++11 -O2 -I. extras/VectorSearchBenchmark.cpp -o VectorSearchBenchmark
+// x86-64 always has SSE2, add -mavx2 to measure the AVX2 versions.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+#include "Array.h"
+
+constexpr uint32_t itemCount = 4096;
+constexpr uint32_t repeats = 100000;
+
+// Stops the compiler dropping work whose result is never read
+volatile uint32_t sink;
+
+template< typename Function >
+double measure(Function function)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t repeat = 0; repeat < repeats; ++repeat)
+	{
+		// Tells the compiler the array may have changed, so the search can't be hoisted out of the loop
+		asm volatile("" ::: "memory");
+		sink = static_cast<uint32_t>(function());
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / repeats;
+}
+
+template< typename Vector, typename Loop >
+void compare(const char * name, Vector vector, Loop loop)
+{
+	const double vectorTime = measure(vector);
+	const double loopTime = measure(loop);
+
+	printf("  %-32s %10.1f ns %10.1f ns %8.1fx\n", name, vectorTime, loopTime, (loopTime / vectorTime));
+}
+
+template< typename Type >
+void report(const char * name)
+{
+	using ArrayType = Array<Type, itemCount>;
+
+	// Every item is 1 apart from a 2 at each end, and nothing is 3, 4, 5 or 6
+	static ArrayType array;
+	array.fill(1);
+	array[0] = 2;
+	array[itemCount - 1] = 2;
+
+	const Type * const first = array.getData();
+	const Type * const last = (first + itemCount);
+
+	const Type missing = 3;
+	const Type found = 2;
+	const Type set[] = { 3, 4, 5, 6 };
+
+	printf("%s\n", name);
+
+	compare("contains, not present",
+		[&]() { return array.contains(missing); },
+		[&]() { return (stdlib::details::find(first, last, missing, stdlib::false_type()) != last); });
+
+	compare("indexOfFirst, not present",
+		[&]() { return array.indexOfFirst(missing); },
+		[&]() { return (stdlib::details::find(first, last, missing, stdlib::false_type()) - first); });
+
+	compare("indexOfLast, not present",
+		[&]() { return array.indexOfLast(missing); },
+		[&]() { return (stdlib::details::find_last(first, last, missing, stdlib::false_type()) - first); });
+
+	compare("count",
+		[&]() { return array.count(found); },
+		[&]() { return stdlib::details::count(first, last, found, stdlib::false_type()); });
+
+	compare("indexOfAny of 4, not present",
+		[&]() { return array.indexOfAny(set, 4); },
+		[&]() { return (stdlib::details::find_first_of(first, last, &set[0], &set[4], stdlib::false_type()) - first); });
+}
+
+int main()
+{
+	printf("  %-32s %13s %13s %9s\n", "Per search of 4096 items", "vectorised", "plain loop", "speedup");
+
+	report<uint8_t>("uint8_t");
+	report<int16_t>("int16_t");
+	report<int32_t>("int32_t");
+}